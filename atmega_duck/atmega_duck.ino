@@ -38,7 +38,8 @@ void loop() {
 
         for (size_t i = 0; i<buffer.len; i++) debug(buffer.data[i]);
 
-        duckparser::parse(buffer.data, buffer.len);
+        if (com::isBytecode()) duckparser::execute(buffer.data, buffer.len);
+        else duckparser::parse(buffer.data, buffer.len);
 
         com::sendDone();
     }
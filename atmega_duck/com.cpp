@@ -12,12 +12,30 @@
 #include "debug.h"
 #include "duckparser.h"
 
+#ifdef ENABLE_COMPRESSION
+#include "dictionary.h"
+#endif // ifdef ENABLE_COMPRESSION
+
 // ! Communication request codes
 #define REQ_SOT 0x01     // !< Start of transmission
 #define REQ_EOT 0x04     // !< End of transmission
 #define REQ_VERSION 0x02 // !< Request current version
+#define REQ_SOB 0x03     // !< Start of bytecode transmission
+#define REQ_STATUS 0x05  // !< Request status
+#define REQ_ESCAPE 0x10  // !< Next payload byte is XORed with 0x40
+#define REQ_RESUME 0x11  // !< Continue typing
+#define REQ_PAUSE 0x13   // !< Hold typing at the next keystroke
+#define REQ_ABORT 0x18   // !< Stop typing and drop everything received so far
+#define REQ_DICT 0x1C    // !< Insert a dictionary entry (index + 0x20)
+#define REQ_MATCH 0x1D   // !< Repeat earlier bytes of the transmission (distance - 1 + 0x20, length - 4 + 0x20)
+
+#define COM_VERSION 11
 
-#define COM_VERSION 4
+// ! Status flags
+#define STATUS_PAUSED 0x01
+
+// ! Capabilities
+#define CAP_COMPRESSION 0x01
 
 // ! Heartbeat configuration
 #ifndef ENABLE_HEARTBEAT
@@ -27,10 +45,29 @@
 #define HEARTBEAT_MS 1000UL
 #endif
 
+// ! Flow control configuration
+// The hardware serial RX ring buffer (64 byte) is only emptied by the main loop,
+// so never grant more credit than it can hold while the parser is busy.
+#ifndef SERIAL_CREDIT
+#define SERIAL_CREDIT 56
+#endif
+
+#ifdef ENABLE_SERIAL
+#define MAX_CREDIT SERIAL_CREDIT
+#else // ifdef ENABLE_SERIAL
+#define MAX_CREDIT BUFFER_SIZE
+#endif // ifdef ENABLE_SERIAL
+
 typedef struct status_t {
-    unsigned int version : 8;
-    unsigned int wait    : 16;
-    unsigned int repeat  : 8;
+    unsigned int version  : 8;
+    unsigned int wait     : 16;
+    unsigned int repeat   : 8;
+    unsigned int credit   : 16; // Free bytes in the receive buffer
+    unsigned int received : 16; // Bytes received overall (wraps around)
+    unsigned int packet   : 8;  // Max. bytes per I2C transmission
+    unsigned int flags    : 8;  // STATUS_PAUSED
+    unsigned int caps     : 8;  // CAP_COMPRESSION
+    unsigned int delay    : 16; // Remaining delay in ms
 } status_t;
 
 namespace com {
@@ -40,48 +77,295 @@ namespace com {
 
     bool start_parser         = false;
     bool ongoing_transmission = false;
+    bool bytecode             = false; // Current transmission is bytecode instead of text
 
     status_t status;
 
+    // The I2C interrupt only copies the last published snapshot,
+    // the main loop writes the other one and then swaps them
+    status_t snapshots[2];
+    volatile uint8_t snapshot = 0;
+
+    // Control requests can arrive in the middle of a frame and are handled right away
+    volatile bool status_requested = false;
+    volatile bool abort_pending    = false;
+    volatile bool rx_flushed       = false; // Receive buffer was emptied by an abort
+
+    // Number of bytes received overall, used by the ESP to calculate bytes in flight
+    volatile uint16_t received = 0;
+
+    // Credit the ESP was told about in the last status and the receive counter at that time
+    volatile uint16_t advertised_credit   = 0;
+    volatile uint16_t advertised_received = 0;
+
+    uint16_t free_bytes() {
+        size_t free = BUFFER_SIZE - receive_buf.len;
+
+        if (free > MAX_CREDIT) free = MAX_CREDIT;
+
+        return free;
+    }
+
+    // Whether the ESP is running low on credit and we can offer more
+    bool credit_low() {
+        noInterrupts();
+        uint16_t received_since = received - advertised_received;
+        uint16_t esp_credit     = advertised_credit > received_since ? advertised_credit - received_since : 0;
+        interrupts();
+
+        return (esp_credit < MAX_CREDIT/2) && (free_bytes() > esp_credit);
+    }
+
     void update_status() {
-        status.wait = (uint16_t)receive_buf.len
+        // Credit and received counter must match, the interrupt changes both
+        noInterrupts();
+        size_t rx_len = receive_buf.len;
+        status.credit   = free_bytes();
+        status.received = received;
+        interrupts();
+
+        status.wait = (uint16_t)rx_len
                       + (uint16_t)data_buf.len
                       + (uint16_t)duckparser::getDelayTime();
         status.repeat = (uint8_t)(duckparser::getRepeats() > 255 ? 255 : duckparser::getRepeats());
+        status.delay  = (uint16_t)duckparser::getDelayTime();
+        status.flags  = duckparser::isPaused() ? STATUS_PAUSED : 0;
 
 #if ENABLE_HEARTBEAT
         // Heartbeat: toggle LSB of status.wait to indicate progress
+        // The snapshot is refreshed far more often than it's read, so the toggled bit has to stick
         static unsigned long last_heartbeat = 0;
+        static bool heartbeat = false;
         unsigned long now = millis();
 
         if (status.wait > 0) {
             // If busy and heartbeat interval elapsed, toggle LSB
             if (now - last_heartbeat >= HEARTBEAT_MS) {
-                status.wait ^= 1;
+                heartbeat      = !heartbeat;
                 last_heartbeat = now;
             }
+            if (heartbeat) status.wait ^= 1;
         } else {
             // Reset heartbeat timer when idle
+            heartbeat      = false;
             last_heartbeat = now;
         }
 #endif
     }
 
+    void publish_status() {
+        update_status();
+
+        uint8_t next = snapshot ^ 1;
+
+        snapshots[next] = status;
+        snapshot        = next;
+    }
+
+    // ========== PRIVATE ISR TIMING ========== //
+#ifdef ENABLE_ISR_TIMING
+    typedef struct isr_timing_t {
+        volatile uint16_t last;
+        volatile uint16_t max;
+        uint16_t          printed;
+    } isr_timing_t;
+
+    isr_timing_t request_timing;
+    isr_timing_t receive_timing;
+
+    // Timer1 runs at the CPU clock, its counter gives the cycles spent in a callback
+    void isr_timing_begin() {
+        TCCR1A = 0;
+        TCCR1B = _BV(CS10);
+    }
+
+    uint16_t isr_timing_start() {
+        return TCNT1;
+    }
+
+    void isr_timing_end(isr_timing_t& t, uint16_t start) {
+        uint16_t cycles = TCNT1 - start;
+
+        t.last = cycles;
+        if (cycles > t.max) t.max = cycles;
+    }
+
+    void isr_timing_print(const char* name, isr_timing_t& t) {
+        noInterrupts();
+        uint16_t last = t.last;
+        uint16_t max  = t.max;
+        interrupts();
+
+        if (max == t.printed) return;
+
+        t.printed = max;
+
+        debug(name);
+        debugs(" ISR ");
+        debug(last);
+        debugs(" cycles (max. ");
+        debug(max);
+        debugsln(")");
+    }
+
+    void isr_timing_update() {
+        isr_timing_print("Request", request_timing);
+        isr_timing_print("Receive", receive_timing);
+    }
+
+#else // ifdef ENABLE_ISR_TIMING
+    void isr_timing_begin() {}
+
+    void isr_timing_update() {}
+
+#endif // ifdef ENABLE_ISR_TIMING
+
+    // Returns true if c is a control request and handles it
+    bool control(uint8_t c) {
+        switch (c) {
+            case REQ_STATUS:
+                status_requested = true;
+                return true;
+
+            case REQ_ABORT:
+                receive_buf.len = 0;
+                rx_flushed      = true;
+                abort_pending   = true;
+                duckparser::abort();
+                return true;
+
+            case REQ_PAUSE:
+                duckparser::pause();
+                return true;
+
+            case REQ_RESUME:
+                duckparser::resume();
+                return true;
+        }
+
+        return false;
+    }
+
+    // ========== PRIVATE COMPRESSION ========== //
+#ifdef ENABLE_COMPRESSION
+    // Appends as much of len bytes as fit into the data buffer
+    void decompress_append(const char* src, size_t len, bool progmem) {
+        size_t free = BUFFER_SIZE - data_buf.len;
+
+        if (len > free) len = free;
+
+        if (progmem) memcpy_P(&data_buf.data[data_buf.len], src, len);
+        else {
+            // Can overlap, when the distance is shorter than the length
+            for (size_t i = 0; i < len; ++i) data_buf.data[data_buf.len + i] = src[i];
+        }
+
+        data_buf.len += len;
+    }
+
+    void decompress_dict(uint8_t index) {
+        const char* entry = dictionary;
+
+        index -= 0x20;
+
+        // Skip to the entry, the list ends with an empty one
+        while (index > 0 && pgm_read_byte(entry)) {
+            entry += strlen_P(entry) + 1;
+            --index;
+        }
+
+        decompress_append(entry, strlen_P(entry), true);
+    }
+
+    // The decompressed transmission itself is the window, no extra memory needed
+    void decompress_match(uint8_t distance, uint8_t len) {
+        size_t d = distance - 0x20 + 1;
+
+        if (d > data_buf.len) return;
+
+        decompress_append(&data_buf.data[data_buf.len - d], len - 0x20 + 4, false);
+    }
+
+#else // ifdef ENABLE_COMPRESSION
+    void decompress_dict(uint8_t index) {}
+
+    void decompress_match(uint8_t distance, uint8_t len) {}
+
+#endif // ifdef ENABLE_COMPRESSION
+
     // ========== PRIVATE I2C ========== //
 #ifdef ENABLE_I2C
 
+#ifdef I2C_READY_PIN
+    // Looked up once, so the interrupt can release the pin with a single write
+    volatile uint8_t* ready_ddr;
+    uint8_t ready_mask;
+
+    void i2c_ready_begin() {
+        ready_ddr  = portModeRegister(digitalPinToPort(I2C_READY_PIN));
+        ready_mask = digitalPinToBitMask(I2C_READY_PIN);
+
+        // Open drain, the ESP has a pull-up to 3.3V
+        digitalWrite(I2C_READY_PIN, LOW);
+    }
+
+    void i2c_ready(bool ready) {
+        if (ready) *ready_ddr |= ready_mask;  // Output, pulls low
+        else *ready_ddr &= ~ready_mask;       // Input, released
+    }
+
+#else // ifdef I2C_READY_PIN
+    void i2c_ready_begin() {}
+
+    void i2c_ready(bool ready) {}
+
+#endif // ifdef I2C_READY_PIN
+
     // time sensetive!
+    // Only copies the published snapshot, the main loop keeps it up to date
     void i2c_request() {
-        update_status();
-        Wire.write((uint8_t*)&status, sizeof(status_t));
+#ifdef ENABLE_ISR_TIMING
+        uint16_t start = isr_timing_start();
+#endif // ifdef ENABLE_ISR_TIMING
+
+        const status_t& s = snapshots[snapshot];
+
+        Wire.write((const uint8_t*)&s, sizeof(status_t));
+
+        advertised_credit   = s.credit;
+        advertised_received = s.received;
+
+        i2c_ready(false);
+
+#ifdef ENABLE_ISR_TIMING
+        isr_timing_end(request_timing, start);
+#endif // ifdef ENABLE_ISR_TIMING
     }
 
     // time sensetive!
     void i2c_receive(int len) {
-        if (receive_buf.len + (unsigned int)len <= BUFFER_SIZE) {
-            Wire.readBytes(&receive_buf.data[receive_buf.len], len);
-            receive_buf.len += len;
+#ifdef ENABLE_ISR_TIMING
+        uint16_t start = isr_timing_start();
+#endif // ifdef ENABLE_ISR_TIMING
+
+        while (Wire.available()) {
+            uint8_t c = Wire.read();
+
+            if (control(c)) continue;
+
+            // The ESP never sends more than the advertised credit,
+            // this only protects the buffer against a misbehaving master.
+            // Overflowing bytes still count as received to keep both sides in sync.
+            ++received;
+
+            if (receive_buf.len < BUFFER_SIZE) {
+                receive_buf.data[receive_buf.len++] = c;
+            }
         }
+
+#ifdef ENABLE_ISR_TIMING
+        isr_timing_end(receive_timing, start);
+#endif // ifdef ENABLE_ISR_TIMING
     }
 
     void i2c_begin() {
@@ -90,13 +374,23 @@ namespace com {
         Wire.onRequest(i2c_request);
         Wire.onReceive(i2c_receive);
 
+        i2c_ready_begin();
+        i2c_ready(false);
+
         data_buf.len    = 0;
         receive_buf.len = 0;
     }
 
+    // Signals the ESP to read the new status
+    void i2c_notify() {
+        i2c_ready(true);
+    }
+
 #else // ifdef ENABLE_I2C
     void i2c_begin() {}
 
+    void i2c_notify() {}
+
 #endif // ifdef ENABLE_I2C
 
     // ========== PRIVATE SERIAL ========== //
@@ -106,18 +400,22 @@ namespace com {
         SERIAL_COM.begin(SERIAL_BAUD);
     }
 
+    // Sends the last published snapshot
     void serial_send_status() {
-        update_status();
+        const status_t& s = snapshots[snapshot];
+
 #ifdef ENABLE_DEBUG
         debugs("Replying with status {");
         debugs("wait: ");
-        debug(status.wait);
+        debug(s.wait);
         debugs(",repeat: ");
-        debug(status.repeat);
+        debug(s.repeat);
+        debugs(",credit: ");
+        debug(s.credit);
         debugs("} [");
 
         for (int i = 0; i<sizeof(status_t); ++i) {
-            char b = ((uint8_t*)&status)[i];
+            char b = ((const uint8_t*)&s)[i];
             if (b < 0x10) debug('0');
             debug(String(b, HEX));
             debug(' ');
@@ -126,17 +424,26 @@ namespace com {
 #endif // ifdef ENABLE_DEBUG
 
         SERIAL_COM.write(REQ_SOT);
-        SERIAL_COM.write((uint8_t*)&status, sizeof(status_t));
+        SERIAL_COM.write((const uint8_t*)&s, sizeof(status_t));
         SERIAL_COM.write(REQ_EOT);
         SERIAL_COM.flush();
+
+        advertised_credit   = s.credit;
+        advertised_received = s.received;
     }
 
     void serial_update() {
-        unsigned int len = SERIAL_COM.available();
-
-        if ((len > 0) && (receive_buf.len+len <= BUFFER_SIZE)) {
-            SERIAL_COM.readBytes(&receive_buf.data[receive_buf.len], len);
-            receive_buf.len += len;
+        while (SERIAL_COM.available()) {
+            uint8_t c = SERIAL_COM.peek();
+
+            if (control(c)) {
+                SERIAL_COM.read();
+            } else if (receive_buf.len < BUFFER_SIZE) {
+                receive_buf.data[receive_buf.len++] = SERIAL_COM.read();
+                ++received;
+            } else {
+                break;
+            }
         }
     }
 
@@ -152,36 +459,106 @@ namespace com {
     // ========== PUBLIC ========== //
     void begin() {
         status.version = COM_VERSION;
+#ifdef ENABLE_COMPRESSION
+        status.caps = CAP_COMPRESSION;
+#endif // ifdef ENABLE_COMPRESSION
+#ifdef ENABLE_I2C
+        status.packet = BUFFER_LENGTH; // Size of the Wire library's receive buffer
+#else // ifdef ENABLE_I2C
+        status.packet = 255;
+#endif // ifdef ENABLE_I2C
+        publish_status();
+
+        isr_timing_begin();
         i2c_begin();
         serial_begin();
     }
 
-    void update() {
+    void poll() {
         serial_update();
+        publish_status();
+
+        if (status_requested) {
+            status_requested = false;
+            serial_send_status();
+        }
+    }
+
+    void update() {
+        poll();
+        isr_timing_update();
+
+        if (abort_pending) {
+            debugsln("ABORT");
+
+            noInterrupts();
+            abort_pending = false;
+            interrupts();
+
+            data_buf.len         = 0;
+            start_parser         = false;
+            ongoing_transmission = false;
+
+            duckparser::reset();
+
+            publish_status();
+            i2c_notify();
+            serial_send_status();
+        }
+
+        if (!start_parser && (data_buf.len < BUFFER_SIZE)) {
+            // The I2C interrupt appends to the buffer, only look at what's there right now
+            noInterrupts();
+            size_t len = receive_buf.len;
+            rx_flushed = false;
+            interrupts();
+
+            if (len == 0) return;
 
-        if (!start_parser && (receive_buf.len > 0) && (data_buf.len < BUFFER_SIZE)) {
             unsigned int i = 0;
 
             debugs("RECEIVED ");
 
             // ! Skip bytes until start of transmission
-            while (i < receive_buf.len && !ongoing_transmission) {
+            while (i < len && !ongoing_transmission) {
                 if (receive_buf.data[i] == REQ_SOT) {
                     ongoing_transmission = true;
+                    bytecode             = false;
                     debugs("[SOT] ");
+                } else if (receive_buf.data[i] == REQ_SOB) {
+                    ongoing_transmission = true;
+                    bytecode             = true;
+                    debugs("[SOB] ");
                 }
                 ++i;
             }
 
             debugs("'");
 
-            while (i < receive_buf.len && ongoing_transmission) {
+            while (i < len && ongoing_transmission) {
                 char c = receive_buf.data[i];
 
                 if (c == REQ_EOT) {
                     start_parser         = true;
                     ongoing_transmission = false;
+                } else if (c == REQ_DICT) {
+                    // Wait for the index
+                    if (i + 1 >= len) break;
+                    decompress_dict(receive_buf.data[++i]);
+                    debugs("[DICT] ");
+                } else if (c == REQ_MATCH) {
+                    // Wait for distance and length
+                    if (i + 2 >= len) break;
+                    decompress_match(receive_buf.data[i+1], receive_buf.data[i+2]);
+                    i += 2;
+                    debugs("[MATCH] ");
                 } else {
+                    if (c == REQ_ESCAPE) {
+                        // Wait for the escaped byte
+                        if (i + 1 >= len) break;
+                        c = receive_buf.data[++i] ^ 0x40;
+                    }
+
                     debug(c, BIN);
                     debug(" ");
 
@@ -209,7 +586,20 @@ namespace com {
 
             debugln();
 
-            receive_buf.len = 0;
+            // ! Keep everything after the end of transmission, it belongs to the next one
+            noInterrupts();
+            if (!rx_flushed) {
+                memmove(receive_buf.data, &receive_buf.data[i], receive_buf.len - i);
+                receive_buf.len -= i;
+            }
+            interrupts();
+
+            if (credit_low()) {
+                // The ESP is waiting for room, tell it right away
+                publish_status();
+                i2c_notify();
+                serial_send_status();
+            }
         }
     }
 
@@ -221,9 +611,17 @@ namespace com {
         return data_buf;
     }
 
+    bool isBytecode() {
+        return bytecode;
+    }
+
     void sendDone() {
         data_buf.len = 0;
         start_parser = false;
+
+        // Push the completion instead of waiting to be polled
+        publish_status();
+        i2c_notify();
         serial_send_status();
     }
 }
\ No newline at end of file
@@ -29,12 +29,18 @@ namespace com {
     /*! Updates the communication module */
     void update();
 
+    /*! Handles control requests, safe to call while a frame is being parsed */
+    void poll();
+
     /*! Returns whether or not there's data to be processed */
     bool hasData();
 
     /*! Returns reference to buffer */
     const buffer_t& getBuffer();
 
+    /*! Returns whether the buffer holds bytecode instead of text */
+    bool isBytecode();
+
     /*! Sends acknowledgement that data was parsed and executed */
     void sendDone();
 }
\ No newline at end of file
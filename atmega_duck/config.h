@@ -20,6 +20,7 @@
 // #define ENABLE_DEBUG
 // #define DEBUG_PORT Serial
 // #define DEBUG_BAUD 115200
+// #define ENABLE_ISR_TIMING // Prints the cycles spent in the I2C callbacks, takes over Timer1 (no PWM on pin 9 and 10)
 
 /*! ===== Communication Settings ===== */
 // #define ENABLE_SERIAL
@@ -28,9 +29,11 @@
 
 // #define ENABLE_I2C
 #define I2C_ADDR 0x31
+// #define I2C_READY_PIN 10 // Optional, signals the ESP when a new status is ready
 
 #define BUFFER_SIZE 256
-#define PACKET_SIZE 32
+
+#define ENABLE_COMPRESSION // Accept compressed transmissions, the dictionary takes ~700 byte of flash
 
 /*! ===== LED Settings ===== */
 // #define NEOPIXEL
@@ -60,6 +63,18 @@
 #define ENABLE_I2C
 #endif /* if !defined(ENABLE_I2C) && !defined(ENABLE_SERIAL) */
 
+#if defined(I2C_READY_PIN) && (I2C_READY_PIN==2 || I2C_READY_PIN==3)
+#error I2C ready pin overlaps with I2C pins!
+#endif /* if defined(I2C_READY_PIN) && (I2C_READY_PIN==2 || I2C_READY_PIN==3) */
+
+#if defined(ENABLE_ISR_TIMING) && !defined(ENABLE_DEBUG)
+#error ISR timing is printed as debug output, enable debugging!
+#endif /* if defined(ENABLE_ISR_TIMING) && !defined(ENABLE_DEBUG) */
+
+#if defined(ENABLE_ISR_TIMING) && defined(LED_RGB) && (LED_R==9 || LED_G==9 || LED_B==9 || LED_R==10 || LED_G==10 || LED_B==10)
+#error ISR timing takes over Timer1, change the LED pins or disable ISR timing!
+#endif /* if defined(ENABLE_ISR_TIMING) && defined(LED_RGB) */
+
 #if defined(BRIDGE_ENABLE) && !defined(ENABLE_SERIAL)
 #warning Serial bridge enabled, but serial communication disabled. Enabling serial again...
 #define ENABLE_SERIAL
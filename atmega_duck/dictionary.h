@@ -0,0 +1,79 @@
+/*
+    This software is licensed under the MIT License. See the license file for details.
+    Source: https://github.com/spacehuhntech/WiFiDuck
+ */
+
+#pragma once
+
+// Static dictionary for compressed transmissions, entries end with '\0'.
+// Transmissions refer to entries by index, so the ESP and the ATmega need the same list.
+// Only append new entries at the end, the list ends with an empty entry.
+const char dictionary[] PROGMEM =
+    "STRINGLN \0"
+    "STRING \0"
+    "DELAY \0"
+    "REM \0"
+    "ENTER\0"
+    "DEFAULTDELAY \0"
+    "STRING_DELAY \0"
+    "REPEAT \0"
+    "LOCALE \0"
+    "GUI r\0"
+    "CTRL \0"
+    "SHIFT \0"
+    "ALT \0"
+    "WINDOWS \0"
+    "powershell \0"
+    "PowerShell\0"
+    " -WindowStyle Hidden\0"
+    " -NoProfile\0"
+    " -ExecutionPolicy Bypass\0"
+    " -Command \0"
+    "Start-Process \0"
+    "Invoke-WebRequest \0"
+    "Invoke-Expression \0"
+    "New-Object \0"
+    "System.Net.WebClient\0"
+    ".DownloadString(\0"
+    ".DownloadFile(\0"
+    "Get-ChildItem \0"
+    "Set-Content \0"
+    "Out-File \0"
+    "Write-Host \0"
+    " -Verb RunAs\0"
+    "$env:\0"
+    "USERPROFILE\0"
+    "C:\\Windows\\System32\\\0"
+    "C:\\Users\\\0"
+    "cmd.exe\0"
+    "cmd /c \0"
+    "notepad\0"
+    "http://\0"
+    "https://\0"
+    "www.\0"
+    ".com\0"
+    ".exe\0"
+    ".txt\0"
+    ".ps1\0"
+    "echo \0"
+    "reg add \0"
+    "HKCU\\Software\\\0"
+    "HKLM\\Software\\\0"
+    "Microsoft\\Windows\\CurrentVersion\\\0"
+    "netsh wlan \0"
+    "ipconfig\0"
+    "whoami\0"
+    "terminal\0"
+    "sudo \0"
+    "/bin/bash\0"
+    "/dev/null\0"
+    "curl \0"
+    "wget \0"
+    "exit\0"
+    "Hello World\0"
+    "the \0"
+    "and \0"
+    "ing \0"
+    "tion\0"
+    "    \0"
+    "\0";
@@ -8,6 +8,7 @@
 
 #include "config.h"
 // #include "debug.h"
+#include "com.h"
 #include "keyboard.h"
 #include "led.h"
 
@@ -18,6 +19,23 @@ extern "C" {
 #define CASE_INSENSETIVE 0
 #define CASE_SENSETIVE 1
 
+// ! Bytecode compiled by the ESP, numbers and lengths are varints (7 bit per byte, LSB first)
+#define OP_STRING 0x80              // !< len, UTF-8 bytes
+#define OP_STRINGLN 0x81            // !< len, UTF-8 bytes
+#define OP_DELAY 0x82               // !< ms
+#define OP_DEFAULT_DELAY 0x83       // !< ms
+#define OP_STRING_DELAY 0x84        // !< ms
+#define OP_STRING_DELAY_RANDOM 0x85 // !< min ms, max ms
+#define OP_REPEAT 0x86              // !< n
+#define OP_LOCALE 0x87              // !< index into locales (byte)
+#define OP_LED 0x88                 // !< r, g, b
+#define OP_KEYCODE 0x89             // !< n, n bytes (modifiers, up to 6 keys)
+#define OP_KEY 0x8A                 // !< HID usage (byte)
+#define OP_MODIFIER 0x8B            // !< modifier mask (byte)
+#define OP_PRESS 0x8C               // !< len, UTF-8 character
+#define OP_RELEASE 0x8D             // !< releases all keys
+#define OP_TYPE 0x8E                // !< len, UTF-8 bytes, part of a longer text
+
 namespace duckparser {
     // ====== PRIVATE ===== //
     bool inString  = false;
@@ -35,10 +53,53 @@ namespace duckparser {
     unsigned long sleepStartTime = 0;
     unsigned long sleepTime      = 0;
 
+    // Set by control requests, which can arrive while a frame is parsed
+    volatile bool aborted = false;
+    volatile bool paused  = false;
+
+    // Keyboard layouts by name, the bytecode refers to them by index
+    typedef struct locale_entry_t {
+        const char  * name;
+        hid_locale_t* locale;
+    } locale_entry_t;
+
+    locale_entry_t locales[] = {
+        { "US", &locale_us },
+        { "DE", &locale_de },
+        { "RU", &locale_ru },
+        { "GB", &locale_gb },
+        { "ES", &locale_es },
+        { "FR", &locale_fr },
+        { "DK", &locale_dk },
+        { "BE", &locale_be },
+        { "PT", &locale_pt },
+        { "IT", &locale_it },
+        { "SK", &locale_sk },
+        { "CZ", &locale_cz },
+        { "SI", &locale_si },
+        { "BG", &locale_bg },
+        { "CA-FR", &locale_cafr },
+        { "CH-DE", &locale_chde },
+        { "CH-FR", &locale_chfr },
+        { "HU", &locale_hu },
+    };
+
+#define LOCALES_LEN (sizeof(locales) / sizeof(locale_entry_t))
+
     void sleep(unsigned long time);
 
+    // Holds typing at the current position until resumed or aborted
+    void waitWhilePaused() {
+        while (paused && !aborted) com::poll();
+    }
+
     void type(const char* str, size_t len) {
         for (size_t i = 0; i < len; ) {
+            com::poll();
+            waitWhilePaused();
+
+            if (aborted) return;
+
             uint8_t consumed = keyboard::write(&str[i]);  // Type one char or UTF-8 sequence
             size_t advance = (consumed > 0) ? consumed : 1;
             i += advance;
@@ -170,7 +231,19 @@ namespace duckparser {
             sleepStartTime = millis();
             sleepTime      = time - offset;
 
-            delay(sleepTime);
+            unsigned long last = sleepStartTime;
+
+            // Keep listening for control requests while sleeping
+            while (!aborted && (paused || (millis() - sleepStartTime < sleepTime))) {
+                com::poll();
+
+                // The remaining time is frozen while paused
+                unsigned long now = millis();
+                if (paused) sleepStartTime += now - last;
+                last = now;
+            }
+
+            if (aborted) sleepTime = 0;
         }
     }
 
@@ -189,6 +262,13 @@ namespace duckparser {
         bool ignore_delay;
 
         while (n) {
+            waitWhilePaused();
+
+            if (aborted) {
+                release();
+                break;
+            }
+
             ignore_delay = false;
 
             word_list* wl  = n->words;
@@ -210,42 +290,11 @@ namespace duckparser {
             else if (compare(cmd->str, cmd->len, "LOCALE", CASE_SENSETIVE)) {
                 word_node* w = cmd->next;
 
-                if (compare(w->str, w->len, "US", CASE_INSENSETIVE)) {
-                    keyboard::setLocale(&locale_us);
-                } else if (compare(w->str, w->len, "DE", CASE_INSENSETIVE)) {
-                    keyboard::setLocale(&locale_de);
-                } else if (compare(w->str, w->len, "RU", CASE_INSENSETIVE)) {
-                    keyboard::setLocale(&locale_ru);
-                } else if (compare(w->str, w->len, "GB", CASE_INSENSETIVE)) {
-                    keyboard::setLocale(&locale_gb);
-                } else if (compare(w->str, w->len, "ES", CASE_INSENSETIVE)) {
-                    keyboard::setLocale(&locale_es);
-                } else if (compare(w->str, w->len, "FR", CASE_INSENSETIVE)) {
-                    keyboard::setLocale(&locale_fr);
-                } else if (compare(w->str, w->len, "DK", CASE_INSENSETIVE)) {
-                    keyboard::setLocale(&locale_dk);
-                } else if (compare(w->str, w->len, "BE", CASE_INSENSETIVE)) {
-                    keyboard::setLocale(&locale_be);
-                } else if (compare(w->str, w->len, "PT", CASE_INSENSETIVE)) {
-                    keyboard::setLocale(&locale_pt);
-                } else if (compare(w->str, w->len, "IT", CASE_INSENSETIVE)) {
-                    keyboard::setLocale(&locale_it);
-                } else if (compare(w->str, w->len, "SK", CASE_INSENSETIVE)) {
-                    keyboard::setLocale(&locale_sk);
-                } else if (compare(w->str, w->len, "CZ", CASE_INSENSETIVE)) {
-                    keyboard::setLocale(&locale_cz);
-                } else if (compare(w->str, w->len, "SI", CASE_INSENSETIVE)) {
-                    keyboard::setLocale(&locale_si);
-                } else if (compare(w->str, w->len, "BG", CASE_INSENSETIVE)) {
-                    keyboard::setLocale(&locale_bg);
-                } else if (compare(w->str, w->len, "CA-FR", CASE_INSENSETIVE)) {
-                    keyboard::setLocale(&locale_cafr);
-                } else if (compare(w->str, w->len, "CH-DE", CASE_INSENSETIVE)) {
-                    keyboard::setLocale(&locale_chde);
-                } else if (compare(w->str, w->len, "CH-FR", CASE_INSENSETIVE)) {
-                    keyboard::setLocale(&locale_chfr);
-                } else if (compare(w->str, w->len, "HU", CASE_INSENSETIVE)) {
-                    keyboard::setLocale(&locale_hu);
+                for (size_t i = 0; i < LOCALES_LEN; ++i) {
+                    if (w && compare(w->str, w->len, locales[i].name, CASE_INSENSETIVE)) {
+                        keyboard::setLocale(locales[i].locale);
+                        break;
+                    }
                 }
                 
                 ignore_delay = true;
@@ -338,7 +387,7 @@ namespace duckparser {
                 inStringLn = !line_end;
                 
                 // Press ENTER when line ends
-                if (line_end) {
+                if (line_end && !aborted) {
                     keyboard::pressKey(KEY_ENTER);
                     keyboard::release();
                 }
@@ -400,7 +449,7 @@ namespace duckparser {
 
             n = n->next;
 
-            if (!inString && !inStringLn && !inComment && !ignore_delay) sleep(defaultDelay);
+            if (!inString && !inStringLn && !inComment && !ignore_delay && !aborted) sleep(defaultDelay);
 
             if (line_end && (repeatNum > 0)) --repeatNum;
 
@@ -410,6 +459,170 @@ namespace duckparser {
         line_list_destroy(l);
     }
 
+    uint32_t readVarint(const uint8_t*& p, const uint8_t* end) {
+        uint32_t val   = 0;
+        uint8_t  shift = 0;
+
+        while (p < end) {
+            uint8_t b = *p++;
+
+            val |= uint32_t(b & 0x7F) << shift;
+
+            if (!(b & 0x80)) break;
+            shift += 7;
+        }
+
+        return val;
+    }
+
+    void execute(const char* code, size_t len) {
+        interpretTime = millis();
+
+        const uint8_t* p   = (const uint8_t*)code;
+        const uint8_t* end = p + len;
+
+        // Flag, no default delay after this instruction
+        bool ignore_delay;
+
+        while (p < end) {
+            waitWhilePaused();
+
+            if (aborted) {
+                release();
+                break;
+            }
+
+            ignore_delay = true;
+
+            uint8_t op = *p++;
+
+            switch (op) {
+                // STRING/STRINGLN (-> type each character)
+                case OP_STRING:
+                case OP_STRINGLN: {
+                    size_t n = readVarint(p, end);
+                    if (n > (size_t)(end - p)) n = end - p;
+
+                    type((const char*)p, n);
+                    p += n;
+
+                    if ((op == OP_STRINGLN) && !aborted) {
+                        keyboard::pressKey(KEY_ENTER);
+                        keyboard::release();
+                    }
+
+                    ignore_delay = false;
+                    break;
+                }
+
+                case OP_DELAY:
+                    sleep(readVarint(p, end));
+                    break;
+
+                case OP_DEFAULT_DELAY:
+                    defaultDelay = readVarint(p, end);
+                    break;
+
+                case OP_STRING_DELAY:
+                    stringDelay    = readVarint(p, end);
+                    useRandomDelay = false;
+                    break;
+
+                case OP_STRING_DELAY_RANDOM:
+                    stringDelayMin = readVarint(p, end);
+                    stringDelayMax = readVarint(p, end);
+                    useRandomDelay = true;
+                    stringDelay    = 0;
+                    break;
+
+                case OP_REPEAT:
+                    repeatNum = readVarint(p, end) + 1;
+                    break;
+
+                case OP_LOCALE:
+                    if ((p < end) && (*p < LOCALES_LEN)) keyboard::setLocale(locales[*p].locale);
+                    ++p;
+                    break;
+
+                case OP_LED: {
+                    int r = readVarint(p, end);
+                    int g = readVarint(p, end);
+                    int b = readVarint(p, end);
+
+                    led::setColor(r, g, b);
+
+                    ignore_delay = false;
+                    break;
+                }
+
+                case OP_KEYCODE: {
+                    size_t n = readVarint(p, end);
+
+                    if (n > 0) {
+                        keyboard::report k;
+
+                        k.modifiers = (p < end) ? *p++ : 0;
+                        k.reserved  = 0;
+
+                        for (uint8_t i = 0; i<6; ++i) {
+                            k.keys[i] = (i + 1 < n && p < end) ? *p++ : 0;
+                        }
+
+                        keyboard::send(&k);
+                        keyboard::release();
+                    }
+
+                    ignore_delay = false;
+                    break;
+                }
+
+                case OP_KEY:
+                    if (p < end) keyboard::pressKey(*p++);
+                    break;
+
+                case OP_MODIFIER:
+                    if (p < end) keyboard::pressModifier(*p++);
+                    break;
+
+                case OP_PRESS: {
+                    size_t n = readVarint(p, end);
+                    if (n > (size_t)(end - p)) n = end - p;
+
+                    if (n > 0) keyboard::press((const char*)p);
+                    p += n;
+                    break;
+                }
+
+                // End of a key combination
+                case OP_RELEASE:
+                    release();
+                    ignore_delay = false;
+                    break;
+
+                // Text that continues in the next frame, no default delay in between
+                case OP_TYPE: {
+                    size_t n = readVarint(p, end);
+                    if (n > (size_t)(end - p)) n = end - p;
+
+                    type((const char*)p, n);
+                    p += n;
+                    break;
+                }
+
+                // Unknown instruction, the rest can't be decoded
+                default:
+                    p = end;
+            }
+
+            if (!ignore_delay && !aborted) sleep(defaultDelay);
+
+            interpretTime = millis();
+        }
+
+        // A frame of bytecode is always one complete line
+        if (repeatNum > 0) --repeatNum;
+    }
+
     int getRepeats() {
         return repeatNum;
     }
@@ -425,4 +638,34 @@ namespace duckparser {
             return (unsigned int)remainingTime;
         }
     }
+
+    void abort() {
+        aborted = true;
+    }
+
+    void pause() {
+        paused = true;
+    }
+
+    void resume() {
+        paused = false;
+    }
+
+    void reset() {
+        inString   = false;
+        inStringLn = false;
+        inComment  = false;
+
+        repeatNum = 0;
+        sleepTime = 0;
+
+        aborted = false;
+        paused  = false;
+
+        keyboard::release();
+    }
+
+    bool isPaused() {
+        return paused;
+    }
 }
@@ -10,6 +10,13 @@
 
 namespace duckparser {
     void parse(const char* str, size_t len);
+    void execute(const char* code, size_t len);
     int getRepeats();
     unsigned int getDelayTime();
+
+    void abort();
+    void pause();
+    void resume();
+    void reset();
+    bool isPaused();
 };
\ No newline at end of file
@@ -17,11 +17,17 @@ extern "C" {
 
 // Import modules used for different commands
 #include "spiffs.h"
+#include "ramdisk.h"
 #include "duckscript.h"
+#include "jobs.h"
+#include "scriptcache.h"
 #include "settings.h"
 #include "com.h"
 #include "config.h"
 
+// Bytes cat prints at once, every print is a WebSocket frame
+#define CAT_CHUNK_SIZE 1024
+
 namespace cli {
     // ===== PRIVATE ===== //
     SimpleCLI cli;           // !< Instance of SimpleCLI library
@@ -41,6 +47,92 @@ namespace cli {
         if (printfunc) printfunc(s.c_str());
     }
 
+    String deferredName;             // !< Last command that runs in the loop, empty if there was none
+    String deferredResult;           // !< Its result, once it's done
+    bool   deferredDone { false };   // !< Whether deferredResult is set
+
+    /*!
+     * \brief Reserves the result for a deferred command
+     *
+     * Commands that take long only start in the callback of the
+     * web server and reply right away. The loop finishes them,
+     * their result is returned by the result command.
+     * Only one of them can run at a time.
+     *
+     * \param name Name of the command
+     * \return false if another one is still running
+     */
+    bool defer(const char* name) {
+        if ((deferredName.length() > 0) && !deferredDone) {
+            print("> " + deferredName + " is running");
+            return false;
+        }
+
+        deferredName   = name;
+        deferredResult = String();
+        deferredDone   = false;
+
+        return true;
+    }
+
+    /*!
+     * \brief Replies to a deferred command
+     *
+     * \param started Whether the command was started
+     * \param error Printed if it wasn't
+     */
+    void deferStarted(bool started, const String& error) {
+        if (started) {
+            print("> " + deferredName + " started, \"result\" returns its result");
+        } else {
+            deferredName = String();
+            print(error);
+        }
+    }
+
+    /*!
+     * \brief Keeps the result of the deferred command
+     *
+     * \param res Result of the command
+     */
+    void deferDone(const String& res) {
+        deferredResult = res;
+        deferredDone   = true;
+    }
+
+    File bench_file; // !< Script used as payload by the bench command
+
+    /*!
+     * \brief Reads the next line of bench_file as a comment
+     *
+     * Starts over at the end of the file.
+     *
+     * \param buf Buffer for the comment
+     * \param len Size of the buffer
+     * \return Length of the comment, 0 if the file is empty
+     */
+    size_t bench_line(char* buf, size_t len) {
+        if (len < 5) return 0;
+
+        if (!bench_file.available()) bench_file.seek(0);
+        if (!bench_file.available()) return 0;
+
+        memcpy(buf, "REM ", 4);
+
+        size_t i = 4;
+
+        while (i < len-1 && bench_file.available()) {
+            char c = bench_file.read();
+            if (c == '\n') break;
+            buf[i++] = c;
+        }
+
+        // Comments must end with a newline, even if the line was cut
+        buf[i++] = '\n';
+
+        return i;
+    }
+
     // ===== PUBLIC ===== //
     void begin() {
         /**
@@ -76,11 +168,16 @@ namespace cli {
         /**
          * \brief Create ram command
          *
-         * Prints number of free bytes in the RAM
+         * Prints number of free bytes in the RAM,
+         * the largest free block, the heap fragmentation
+         * and how much of the line history is used
          */
         cli.addCommand("ram", [](cmd* c) {
             size_t freeRam = system_get_free_heap_size();
-            String res     = String(freeRam) + " bytes available";
+            String res     = String(freeRam) + " bytes available\n" +
+                             String(ESP.getMaxFreeBlockSize()) + " bytes largest block\n" +
+                             String(ESP.getHeapFragmentation()) + "% fragmentation\n" +
+                             String(duckscript::historyUsed()) + "/" + String(HISTORY_SIZE) + " bytes history";
             print(res);
         });
 
@@ -146,7 +243,7 @@ namespace cli {
          * \brief Create status command
          *
          * Prints status of i2c connection to atmega32u4:
-         * running <script>
+         * running <script> (<progress>%)
          * connected
          * i2c connection problem
          */
@@ -154,6 +251,8 @@ namespace cli {
             if (com::connected()) {
                 if (duckscript::isRunning()) {
                     String s = "running " + duckscript::currentScript();
+                    s += " (" + String(duckscript::progress()) + "%)";
+                    if (duckscript::isPaused() || com::paused()) s += " (paused)";
                     print(s);
                 } else {
                     print("connected");
@@ -163,6 +262,49 @@ namespace cli {
             }
         });
 
+        /**
+         * \brief Create bench command
+         *
+         * Measures the throughput of the connection to the atmega32u4
+         * by sending comments to it.
+         * With a file, its lines are sent as comments to measure real payloads.
+         * Without argument, the result of the last benchmark is printed.
+         *
+         * \param * Number of bytes to send, optionally followed by a path to a script
+         */
+        cli.addSingleArgCmd("bench", [](cmd* c) {
+            Command  cmd { c };
+            Argument arg { cmd.getArg(0) };
+
+            String value { arg.getValue() };
+
+            int    space = value.indexOf(' ');
+            String len   = space < 0 ? value : value.substring(0, space);
+            String path  = space < 0 ? String() : value.substring(space + 1);
+
+            if (value.length() == 0) {
+                if (com::benchmarking()) {
+                    print("benchmark running");
+                } else {
+                    String res = String(com::getBenchmark()) + " byte/s (" +
+                                 String(com::getBenchmarkLink()) + " byte/s transmitted)";
+                    print(res);
+                }
+                return;
+            }
+
+            if (bench_file) bench_file.close();
+            if (path.length() > 0) bench_file = spiffs::open(path);
+
+            if (duckscript::isRunning() || ((path.length() > 0) && !bench_file) ||
+                !com::startBenchmark(len.toInt(), bench_file ? bench_line : NULL)) {
+                print("> benchmark not started");
+            } else {
+                String response = "> started benchmark (" + len + " byte)";
+                print(response);
+            }
+        });
+
         /**
          * \brief Create ls command
          *
@@ -181,7 +323,7 @@ namespace cli {
         /**
          * \brief Create mem command
          *
-         * Prints memory usage of SPIFFS
+         * Prints memory usage of SPIFFS and the RAM disk
          */
         cli.addCommand("mem", [](cmd* c) {
             String s = "";
@@ -192,7 +334,9 @@ namespace cli {
             s += String(spiffs::usedBytes());
             s += " byte used\n";
             s += String(spiffs::freeBytes());
-            s += " byte free";
+            s += " byte free\n";
+            s += String(ramdisk::freeBytes());
+            s += " byte free in RAM";
 
             print(s);
         });
@@ -210,20 +354,18 @@ namespace cli {
 
             File f = spiffs::open(arg.getValue());
 
-            int buf_size { 256 };
-            char buffer[buf_size];
-
-            while (f && f.available()) {
-                for (size_t i = 0; i<buf_size; ++i) {
-                    if (!f.available() || (i == buf_size-1)) {
-                        buffer[i] = '\0';
-                        i         = buf_size;
-                    } else {
-                        buffer[i] = f.read();
-                    }
-                }
+            char* buffer = (char*)malloc(CAT_CHUNK_SIZE + 1);
+
+            while (buffer && f && f.available()) {
+                size_t len = f.read((uint8_t*)buffer, CAT_CHUNK_SIZE);
+                if (len == 0) break;
+
+                buffer[len] = '\0';
                 print(buffer);
             }
+
+            free(buffer);
+            f.close();
         });
 
         /**
@@ -243,6 +385,32 @@ namespace cli {
             print(response);
         });
 
+        /**
+         * \brief Create dryrun command
+         *
+         * Goes through a ducky script without typing it
+         * and estimates how long it takes on the atmega32u4.
+         * It runs in the loop, once it's done the result command
+         * returns the time, keystrokes, frames and the slowest lines.
+         *
+         * \param * Path to script in SPIFFS
+         */
+        cli.addSingleArgCmd("dryrun", [](cmd* c) {
+            Command  cmd { c };
+            Argument arg { cmd.getArg(0) };
+
+            if (duckscript::isRunning()) {
+                print("> a script is running");
+                return;
+            }
+
+            if (!defer("dryrun")) return;
+
+            deferStarted(duckscript::dryrun(arg.getValue(), [](const String& res) {
+                deferDone(res.length() > 0 ? res : String("> script has errors"));
+            }), "> can't run \"" + arg.getValue() + "\"");
+        });
+
         /**
          * \brief Create stop command
          *
@@ -261,6 +429,158 @@ namespace cli {
             print(response);
         });
 
+        /**
+         * \brief Create enqueue command
+         *
+         * Adds a script to the job queue.
+         * Jobs run back to back, higher priorities first.
+         *
+         * \param * Path to script, optionally followed by a priority (default 0)
+         */
+        cli.addSingleArgCmd("enqueue", [](cmd* c) {
+            Command  cmd { c };
+            Argument arg { cmd.getArg(0) };
+
+            String value { arg.getValue() };
+
+            int    space    = value.indexOf(' ');
+            String path     = space < 0 ? value : value.substring(0, space);
+            int    priority = space < 0 ? 0 : value.substring(space + 1).toInt();
+
+            unsigned int id = jobs::add(path, priority);
+
+            if (id == 0) {
+                print("> job not queued");
+            } else {
+                String response = "> queued job " + String(id);
+                print(response);
+            }
+        });
+
+        /**
+         * \brief Create jobs command
+         *
+         * Prints the job queue, one job per line:
+         * <id> <priority> <script>
+         */
+        cli.addCommand("jobs", [](cmd* c) {
+            String res = jobs::toString();
+            print(res.length() > 0 ? res : String("> no jobs"));
+        });
+
+        /**
+         * \brief Create cancel command
+         *
+         * Removes a job from the queue
+         *
+         * \param * Job id
+         */
+        cli.addSingleArgCmd("cancel", [](cmd* c) {
+            Command  cmd { c };
+            Argument arg { cmd.getArg(0) };
+
+            if (jobs::cancel(arg.getValue().toInt())) {
+                String response = "> canceled job " + arg.getValue();
+                print(response);
+            } else {
+                print("> no such job");
+            }
+        });
+
+        /**
+         * \brief Create priority command
+         *
+         * Changes the priority of a queued job
+         *
+         * \param id       Job id
+         * \param priority Higher runs first
+         */
+        Command cmdPriority {
+            cli.addCommand("priority", [](cmd* c) {
+                Command cmd { c };
+
+                Argument argId { cmd.getArg(0) };
+                Argument argPriority { cmd.getArg(1) };
+
+                if (jobs::setPriority(argId.getValue().toInt(), argPriority.getValue().toInt())) {
+                    print(jobs::toString());
+                } else {
+                    print("> no such job");
+                }
+            })
+        };
+        cmdPriority.addPosArg("i/d");
+        cmdPriority.addPosArg("p/riority");
+
+        /**
+         * \brief Create pause command
+         *
+         * Holds the script and typing on the atmega32u4 at the next keystroke
+         */
+        cli.addCommand("pause", [](cmd* c) {
+            duckscript::pause();
+            print("> paused");
+        });
+
+        /**
+         * \brief Create resume command
+         *
+         * Continues typing after a pause.
+         * A stopped script continues where it was stopped,
+         * including the delay and repetitions that were left.
+         *
+         * \param * Line to continue from (optional, starting at 1)
+         */
+        cli.addSingleArgCmd("resume", [](cmd* c) {
+            Command  cmd { c };
+            Argument arg { cmd.getArg(0) };
+
+            String value { arg.getValue() };
+            bool   resumed;
+
+            if (value.length() == 0) {
+                resumed = duckscript::resume();
+            } else {
+                int line = value.toInt();
+                resumed = (line > 0) && duckscript::resume(line - 1);
+            }
+
+            print(resumed ? "> resumed" : "> nothing to resume");
+        });
+
+        /**
+         * \brief Create seek command
+         *
+         * Continues the running script at a line,
+         * whatever the atmega32u4 is still typing is dropped
+         *
+         * \param * Line number (starting at 1)
+         */
+        cli.addSingleArgCmd("seek", [](cmd* c) {
+            Command  cmd { c };
+            Argument arg { cmd.getArg(0) };
+
+            int line = arg.getValue().toInt();
+
+            if ((line > 0) && duckscript::seek(line - 1)) {
+                String response = "> line " + String(line);
+                print(response);
+            } else {
+                print("> seek failed");
+            }
+        });
+
+        /**
+         * \brief Create latency command
+         *
+         * Prints how long the last stop took
+         * until the atmega32u4 was idle
+         */
+        cli.addCommand("latency", [](cmd* c) {
+            String res = String(com::getAbortLatency()) + " ms";
+            print(res);
+        });
+
         /**
          * \brief Create create command
          *
@@ -359,6 +679,73 @@ namespace cli {
             print("Formatted SPIFFS");
         });
 
+        /**
+         * \brief Create fsbench command
+         *
+         * Measures listing, open latency and read throughput
+         * of the file system with temporary files.
+         * It runs in the loop, the result command returns
+         * the result when it's done.
+         *
+         * \param * Number of files (default 100)
+         */
+        cli.addSingleArgCmd("fsbench", [](cmd* c) {
+            Command  cmd { c };
+            Argument arg { cmd.getArg(0) };
+
+            String value { arg.getValue() };
+            int    files = value.length() > 0 ? value.toInt() : 100;
+
+            if (duckscript::isRunning()) {
+                print("> a script is running");
+                return;
+            }
+
+            if (!defer("fsbench")) return;
+
+            deferStarted((files > 0) && spiffs::benchmark(files, [](const String& res) {
+                deferDone(res);
+            }), "> not enough space");
+        });
+
+        /**
+         * \brief Create result command
+         *
+         * Returns the result of the last dryrun or fsbench,
+         * or that it is still running.
+         */
+        cli.addCommand("result", [](cmd* c) {
+            if (deferredName.length() == 0) print("> nothing ran");
+            else if (!deferredDone) print("> " + deferredName + " is running");
+            else print(deferredResult);
+        });
+
+        /**
+         * \brief Create cache command
+         *
+         * Manages the recorded runs of scripts.
+         * A script that ran to its end once is sent from its recording
+         * the next time, until its content changes.
+         *
+         * \param * list (default), verify or purge
+         */
+        cli.addSingleArgCmd("cache", [](cmd* c) {
+            Command  cmd { c };
+            Argument arg { cmd.getArg(0) };
+
+            String value { arg.getValue() };
+
+            if (value == "purge") {
+                String response = "> removed " + String(scriptcache::purge()) + " entries";
+                print(response);
+            } else if ((value.length() == 0) || (value == "list") || (value == "verify")) {
+                String res = scriptcache::list(value == "verify");
+                print(res.length() > 0 ? res : String("> cache is empty"));
+            } else {
+                print("> unknown cache command");
+            }
+        });
+
         /**
          * \brief Create stream command
          *
@@ -414,8 +801,11 @@ namespace cli {
         if (spiffs::streaming() &&
             (strcmp(input, "close\n") != 0) &&
             (strcmp(input, "read\n") != 0)) {
-            spiffs::streamWrite(input, strlen(input));
-            print("> Written data to file");
+            if (spiffs::streamWrite(input, strlen(input))) {
+                print("> Written data to file");
+            } else {
+                print("> ERROR: couldn't write data to file");
+            }
         } else {
             if (echo) {
                 String s = "# " + String(input);
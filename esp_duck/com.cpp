@@ -12,60 +12,179 @@
 #include "config.h"
 #include "debug.h"
 
+#ifdef ENABLE_COMPRESSION
+#include "dictionary.h"
+#endif // ifdef ENABLE_COMPRESSION
+
 // ! Communication request codes
 #define REQ_SOT 0x01     // !< Start of transmission
 #define REQ_EOT 0x04     // !< End of transmission
 #define REQ_VERSION 0x02 // !< Request current version
-
-#define COM_VERSION 4
+#define REQ_SOB 0x03     // !< Start of bytecode transmission
+#define REQ_STATUS 0x05  // !< Request status
+#define REQ_ESCAPE 0x10  // !< Next payload byte is XORed with 0x40
+#define REQ_RESUME 0x11  // !< Continue typing
+#define REQ_PAUSE 0x13   // !< Hold typing at the next keystroke
+#define REQ_ABORT 0x18   // !< Stop typing and drop everything received so far
+#define REQ_DICT 0x1C    // !< Insert a dictionary entry (index + 0x20)
+#define REQ_MATCH 0x1D   // !< Repeat earlier bytes of the transmission (distance - 1 + 0x20, length - 4 + 0x20)
+
+#define COM_VERSION 11
+
+// ! Status flags
+#define STATUS_PAUSED 0x01
+
+// ! Capabilities
+#define CAP_COMPRESSION 0x01
+
+// ! Compression limits, arguments are sent as bytes from 0x20 to 0xFF
+#define DICT_MAX 224
+#define MATCH_DISTANCE_MAX 224
+#define MATCH_LEN_MIN 4
+#define MATCH_LEN_MAX (MATCH_LEN_MIN + 223)
+
+// Size of a status reply in bytes
+#define STATUS_SIZE 13
+
+// Size of the Wire library's transmit buffer
+#if defined(I2C_BUFFER_LENGTH)
+#define I2C_PACKET_SIZE I2C_BUFFER_LENGTH
+#else // if defined(I2C_BUFFER_LENGTH)
+#define I2C_PACKET_SIZE BUFFER_LENGTH
+#endif // if defined(I2C_BUFFER_LENGTH)
+
+// Outgoing bytes are queued until the ATmega has room for them,
+// in the worst case every payload byte is escaped
+#define TX_BUFFER_SIZE ((BUFFER_SIZE * 2 + 2) * 2)
 
 // Transmit timeout in milliseconds (60 seconds).
 // Long timeout accommodates slow/long script lines that may take time to process.
 #define TRANSMIT_TIMEOUT_MS 60000UL
 
+// With a ready pin, the status is still polled this often in case a signal was missed
+#define READY_POLL_MS 500UL
+
 typedef struct status_t {
-    unsigned int version : 8;
-    unsigned int wait    : 16;
-    unsigned int repeat  : 8;
+    unsigned int version  : 8;
+    unsigned int wait     : 16;
+    unsigned int repeat   : 8;
+    unsigned int credit   : 16; // Free bytes in the ATmega's receive buffer
+    unsigned int received : 16; // Bytes the ATmega received overall (wraps around)
+    unsigned int packet   : 8;  // Max. bytes the ATmega can receive per I2C transmission
+    unsigned int flags    : 8;  // STATUS_PAUSED
+    unsigned int caps     : 8;  // CAP_COMPRESSION
+    unsigned int delay    : 16; // Remaining delay of the ATmega in ms
 } status_t;
 
 namespace com {
     // ========== PRIVATE ========== //
     bool connection = false;
 
-    com_callback callback_done   = NULL;
-    com_callback callback_repeat = NULL;
-    com_callback callback_error  = NULL;
+    com_callback callback_done    = NULL;
+    com_callback callback_repeat  = NULL;
+    com_callback callback_error   = NULL;
+    com_callback callback_aborted = NULL;
 
     bool react_on_status  = false;
     bool new_transmission = false;
 
     status_t status;
 
+    char   tx_buf[TX_BUFFER_SIZE]; // Bytes waiting for credit
+    size_t tx_len = 0;
+
+    uint16_t tx_total = 0;         // Bytes transmitted overall (wraps around)
+
+    // Link benchmark
+    bool benchmark_running        = false;
+    unsigned long benchmark_left  = 0; // Payload bytes left to queue
+    unsigned long benchmark_bytes = 0; // Payload bytes of the last benchmark
+    unsigned long benchmark_start = 0;
+    unsigned long benchmark_time  = 0; // Duration of the last benchmark in ms
+    unsigned long benchmark_link  = 0; // Bytes transmitted for the last benchmark
+    com_source    benchmark_source = NULL;
+
+    // Bytecode frames that are generated while the ATmega types
+    bool       stream_running = false;
+    com_source stream_source  = NULL; // NULL once it ran dry
+
+    // Stop latency
+    bool abort_running          = false;
+    unsigned long abort_time    = 0; // When the last abort was sent
+    unsigned long abort_latency = 0; // Time from the last abort until the ATmega was idle in ms
+
     // Retry count for diagnostics/logging (not used for timeout control)
     uint8_t transm_tries = 3;
     
     // Track time when retransmission started (for time-based timeout)
     unsigned long transm_start_time = 0;
 
+    // Bytes that were transmitted, but not yet received by the ATmega
+    uint16_t in_flight() {
+        return tx_total - status.received;
+    }
+
+    // Bytes we're allowed to transmit right now
+    unsigned int credit() {
+        if (in_flight() >= status.credit) return 0;
+        return status.credit - in_flight();
+    }
+
+    bool control(uint8_t c);
+
+    void parse_status(Stream& s) {
+        uint16_t prev_wait = status.wait;
+
+        status.version = s.read();
+
+        status.wait  = s.read();
+        status.wait |= uint16_t(s.read()) << 8;
+
+        status.repeat = s.read();
+
+        status.credit  = s.read();
+        status.credit |= uint16_t(s.read()) << 8;
+
+        status.received  = s.read();
+        status.received |= uint16_t(s.read()) << 8;
+
+        status.packet = s.read();
+
+        status.flags = s.read();
+
+        status.caps = s.read();
+
+        status.delay  = s.read();
+        status.delay |= uint16_t(s.read()) << 8;
+
+        // ATmega was reset, start counting from its value
+        if (in_flight() > TX_BUFFER_SIZE) tx_total = status.received;
+
+        // Only react when everything we sent has arrived
+        react_on_status = tx_len == 0 && in_flight() == 0 && (
+            status.wait == 0 ||
+            status.repeat > 0 ||
+            ((prev_wait&1) ^ (status.wait&1)));
+    }
+
     // ========= PRIVATE I2C ========= //
 
 #ifdef ENABLE_I2C
     unsigned long request_time = 0;
 
-    void i2c_start_transmission() {
+    bool i2c_transmit(const char* buf, size_t len) {
         Wire.beginTransmission(I2C_ADDR);
-        debug("Transmitting '");
-    }
+        Wire.write((const uint8_t*)buf, len);
 
-    void i2c_stop_transmission() {
-        Wire.endTransmission();
-        debugln("' ");
-        delay(1);
+        // The ATmega stretches the clock until it's ready,
+        // so the next packet can follow right away
+        return Wire.endTransmission() == 0;
     }
 
-    void i2c_transmit(char b) {
-        Wire.write(b);
+    size_t i2c_packet_size(size_t len) {
+        if (len > I2C_PACKET_SIZE) len = I2C_PACKET_SIZE;
+        if (len > status.packet) len = status.packet;
+        return len;
     }
 
     void i2c_request() {
@@ -73,15 +192,10 @@ namespace com {
 
         uint16_t prev_wait = status.wait;
 
-        Wire.requestFrom(I2C_ADDR, sizeof(status_t));
-
-        if (Wire.available() == sizeof(status_t)) {
-            status.version = Wire.read();
+        Wire.requestFrom(I2C_ADDR, STATUS_SIZE);
 
-            status.wait  = Wire.read();
-            status.wait |= uint16_t(Wire.read()) << 8;
-
-            status.repeat = Wire.read();
+        if (Wire.available() == STATUS_SIZE) {
+            parse_status(Wire);
 
             debugf(" %u", status.wait);
         } else {
@@ -89,14 +203,10 @@ namespace com {
             debug(" ERROR");
         }
 
-        react_on_status = status.wait == 0 ||
-                          status.repeat > 0 ||
-                          ((prev_wait&1) ^ (status.wait&1));
-
         debugln();
 
-        // Time-based retransmit logic for unprocessed messages
-        if (!react_on_status && (status.wait == prev_wait)) {
+        // Time-based timeout when the ATmega stops making progress
+        if (!react_on_status && !(status.flags & STATUS_PAUSED) && (status.wait == prev_wait) && (tx_len == 0) && (in_flight() == 0)) {
             debug("Last message was not processed");
 
             // Start timer on first detection
@@ -113,12 +223,8 @@ namespace com {
                 transm_start_time = 0;
                 debugln("...TIMEOUT ERROR");
             } else {
-                // Still within timeout - repeat the message
-                debugln("...repeating last line");
-
-                status.repeat = 1;
-
-                react_on_status = true;
+                // Credit based flow control means nothing gets dropped, keep waiting
+                debugln("...waiting");
 
                 ++transm_tries;
             }
@@ -131,12 +237,35 @@ namespace com {
         request_time = millis();
     }
 
+#ifdef I2C_READY_PIN
+    volatile bool ready_signal = false;
+
+    void IRAM_ATTR i2c_ready_isr() {
+        ready_signal = true;
+    }
+
+    // The ATmega pulls the pin low when it has a new status
+    bool i2c_ready() {
+        bool ready = ready_signal || digitalRead(I2C_READY_PIN) == LOW;
+
+        ready_signal = false;
+
+        return ready;
+    }
+
+#endif // ifdef I2C_READY_PIN
+
     void i2c_begin() {
         unsigned long start_time = millis();
 
         Wire.begin(I2C_SDA, I2C_SCL);
         Wire.setClock(I2C_CLOCK_SPEED);
 
+#ifdef I2C_READY_PIN
+        pinMode(I2C_READY_PIN, INPUT_PULLUP);
+        attachInterrupt(digitalPinToInterrupt(I2C_READY_PIN), i2c_ready_isr, FALLING);
+#endif // ifdef I2C_READY_PIN
+
         while (Wire.available()) Wire.read();
 
         debugln("Connecting via i2c");
@@ -155,20 +284,36 @@ namespace com {
         if (!connection) return;
 
         bool processing = status.wait > 0;
+        bool waiting_for_credit = tx_len > 0 && credit() == 0;
+
+#ifdef I2C_READY_PIN
+        // Completion and new credit are signaled, polling is only a fallback
+        bool ready = i2c_ready() ||
+                     ((processing || waiting_for_credit) && (request_time + READY_POLL_MS < millis()));
+#else // ifdef I2C_READY_PIN
         bool delay_over = request_time + status.wait < millis();
 
-        if (new_transmission || (processing && delay_over)) {
+        // Poll for new credit at most once per millisecond
+        bool ready = (waiting_for_credit && request_time != millis()) || (processing && delay_over);
+#endif // ifdef I2C_READY_PIN
+
+        // Watch closely how long an abort takes
+        if (abort_running && (request_time != millis())) ready = true;
+
+        if (new_transmission || ready) {
             new_transmission = false;
             i2c_request();
         }
     }
 
 #else // ifdef ENABLE_I2C
-    void i2c_start_transmission() {}
-
-    void i2c_stop_transmission() {}
+    bool i2c_transmit(const char* buf, size_t len) {
+        return true;
+    }
 
-    void i2c_transmit(char b) {}
+    size_t i2c_packet_size(size_t len) {
+        return len;
+    }
 
     void i2c_request() {}
 
@@ -178,22 +323,14 @@ namespace com {
 
 #endif // ifdef ENABLE_I2C
 
-    // ========= PRIVATE I2C ========= //
+    // ========= PRIVATE SERIAL ========= //
 
 #ifdef ENABLE_SERIAL
     bool ongoing_transmission = false;
 
-    void serial_start_transmission() {
-        debug("Transmitting '");
-    }
-
-    void serial_stop_transmission() {
-        SERIAL_PORT.flush();
-        debugln("' ");
-    }
-
-    void serial_transmit(char b) {
-        SERIAL_PORT.write(b);
+    bool serial_transmit(const char* buf, size_t len) {
+        SERIAL_PORT.write((const uint8_t*)buf, len);
+        return true;
     }
 
     void serial_begin() {
@@ -205,6 +342,9 @@ namespace com {
 
         connection = true;
 
+        // Ask for the initial credit, the ATmega pushes every update after that
+        control(REQ_STATUS);
+
         send(MSG_CONNECTED);
 
         update();
@@ -214,59 +354,291 @@ namespace com {
     }
 
     void serial_update() {
-        if (SERIAL_PORT.available() >= sizeof(status_t)+2) {
+        while (SERIAL_PORT.available() >= STATUS_SIZE+2) {
             if (SERIAL_PORT.read() == REQ_SOT) {
-                uint16_t prev_wait = status.wait;
+                parse_status(SERIAL_PORT);
 
-                status.version = SERIAL_PORT.read();
+                while (SERIAL_PORT.available() && SERIAL_PORT.read() != REQ_EOT) {}
+            }
+        }
+    }
 
-                status.wait  = SERIAL_PORT.read();
-                status.wait |= uint16_t(SERIAL_PORT.read()) << 8;
+#else // ifdef ENABLE_SERIAL
+    bool serial_transmit(const char* buf, size_t len) {
+        return true;
+    }
 
-                status.repeat = SERIAL_PORT.read();
+    void serial_begin() {}
 
-                react_on_status = status.wait == 0 ||
-                                  status.repeat > 0 ||
-                                  ((prev_wait&1) ^ (status.wait&1));
+    void serial_update() {}
 
-                while (SERIAL_PORT.available() && SERIAL_PORT.read() != REQ_EOT) {}
+#endif // ifdef ENABLE_SERIAL
+
+    bool transmit(const char* buf, size_t len) {
+        bool i2c_ok    = i2c_transmit(buf, len);
+        bool serial_ok = serial_transmit(buf, len);
+
+        return i2c_ok && serial_ok;
+    }
+
+    // Payload bytes below 0x20 are reserved for requests, except for tab and line endings
+    bool escape(uint8_t c) {
+        return c < 0x20 && c != '\t' && c != '\n' && c != '\r';
+    }
+
+    size_t encode_literal(uint8_t c, char* out) {
+        if (escape(c)) {
+            out[0] = REQ_ESCAPE;
+            out[1] = c ^ 0x40;
+            return 2;
+        }
+
+        out[0] = c;
+        return 1;
+    }
+
+    // ========= PRIVATE COMPRESSION ========= //
+
+#ifdef ENABLE_COMPRESSION
+    // Index of the dictionary in flash, the first byte of each entry is kept to skip most comparisons
+    uint16_t dict_offset[DICT_MAX];
+    uint8_t  dict_len[DICT_MAX];
+    char     dict_first[DICT_MAX];
+    size_t   dict_size = 0;
+
+    void compression_begin() {
+        size_t offset = 0;
+
+        dict_size = 0;
+
+        while (dict_size < DICT_MAX && pgm_read_byte(dictionary + offset)) {
+            size_t len = strlen_P(dictionary + offset);
+
+            dict_offset[dict_size] = offset;
+            dict_len[dict_size]    = len;
+            dict_first[dict_size]  = pgm_read_byte(dictionary + offset);
+
+            offset += len + 1;
+            ++dict_size;
+        }
+    }
+
+    bool compression() {
+        return status.caps & CAP_COMPRESSION;
+    }
+
+    // Greedy, picks whatever saves the most bytes at each position:
+    // a dictionary entry (2 byte) or a match earlier in the same transmission (3 byte)
+    size_t encode(const char* str, size_t len, char* out) {
+        if (!compression()) {
+            size_t o = 0;
+
+            for (size_t i = 0; i < len; ++i) o += encode_literal(str[i], &out[o]);
+            return o;
+        }
+
+        size_t o = 0;
+        size_t i = 0;
+
+        while (i < len) {
+            size_t left = len - i;
+
+            int    best_saving = 0;
+            int    best_dict   = -1;
+            size_t best_dist   = 0;
+            size_t best_len    = 0;
+
+            for (size_t d = 0; d < dict_size; ++d) {
+                size_t l = dict_len[d];
+
+                if ((dict_first[d] == str[i]) && (l <= left) && ((int)l - 2 > best_saving) &&
+                    (memcmp_P(&str[i], dictionary + dict_offset[d], l) == 0)) {
+                    best_saving = l - 2;
+                    best_dict   = d;
+                }
+            }
+
+            size_t max_dist = _min(i, (size_t)MATCH_DISTANCE_MAX);
+            size_t max_len  = _min(left, (size_t)MATCH_LEN_MAX);
+
+            for (size_t dist = 1; dist <= max_dist; ++dist) {
+                const char* p = &str[i - dist];
+                size_t l      = 0;
+
+                while (l < max_len && p[l] == str[i + l]) ++l;
+
+                if ((l >= MATCH_LEN_MIN) && ((int)l - 3 > best_saving)) {
+                    best_saving = l - 3;
+                    best_dict   = -1;
+                    best_dist   = dist;
+                    best_len    = l;
+                }
+            }
+
+            if (best_saving <= 0) {
+                o += encode_literal(str[i], &out[o]);
+                ++i;
+            } else if (best_dict >= 0) {
+                out[o++] = REQ_DICT;
+                out[o++] = best_dict + 0x20;
+                i       += dict_len[best_dict];
+            } else {
+                out[o++] = REQ_MATCH;
+                out[o++] = best_dist - 1 + 0x20;
+                out[o++] = best_len - MATCH_LEN_MIN + 0x20;
+                i       += best_len;
             }
         }
+
+        return o;
     }
 
-#else // ifdef ENABLE_SERIAL
-    void serial_start_transmission() {}
+#else // ifdef ENABLE_COMPRESSION
+    void compression_begin() {}
 
-    void serial_stop_transmission() {}
+    size_t encode(const char* str, size_t len, char* out) {
+        size_t o = 0;
 
-    void serial_transmit(char b) {}
+        for (size_t i = 0; i < len; ++i) o += encode_literal(str[i], &out[o]);
+        return o;
+    }
 
-    void serial_begin() {}
+#endif // ifdef ENABLE_COMPRESSION
 
-    void serial_update() {}
+    // Control requests bypass the queue and the credit,
+    // the ATmega handles them as soon as they arrive, even in the middle of a frame
+    bool control(uint8_t c) {
+        if (!connection) return false;
 
-#endif // ifdef ENABLE_SERIAL
+        debugf("Control request 0x%02X\n", c);
+
+        return transmit((const char*)&c, 1);
+    }
+
+    // Transmits as many queued bytes as the ATmega has room for
+    void transmit_pending() {
+        if (tx_len == 0) return;
+
+        size_t len = i2c_packet_size(_min(credit(), tx_len));
+
+        while (len > 0) {
+            debugf("Transmitting %u byte\n", len);
+
+            if (!transmit(tx_buf, len)) {
+                debugln("Transmission ERROR");
+                break;
+            }
+
+            tx_total += len;
+            tx_len   -= len;
+
+            if (benchmark_running) benchmark_link += len;
+            memmove(tx_buf, &tx_buf[len], tx_len);
+
+            len = i2c_packet_size(_min(credit(), tx_len));
+        }
+
+        // Ask for the status right away when the last byte was sent
+        if (tx_len == 0) new_transmission = true;
+    }
+
+    // Keeps the queue filled with comments until the benchmark is complete
+    void benchmark_update() {
+        if (!benchmark_running) return;
+
+        while (benchmark_left > 0 && (tx_len + BUFFER_SIZE * 2 + 2 <= TX_BUFFER_SIZE)) {
+            char frame[BUFFER_SIZE];
+            size_t len = _min(benchmark_left, (unsigned long)BUFFER_SIZE);
+
+            if (benchmark_source) {
+                // Real payloads, the source has to turn them into comments
+                len = _min(benchmark_source(frame, len), len);
+            } else {
+                len = 0;
+            }
 
-    void start_transmission() {
-        i2c_start_transmission();
-        serial_start_transmission();
+            if (len == 0) {
+                len = _min(benchmark_left, (unsigned long)BUFFER_SIZE);
+
+                // Must end with a newline, otherwise the next frame counts as comment too
+                memset(frame, 'x', len);
+                memcpy(frame, "REM ", _min(len, (size_t)4));
+                frame[len-1] = '\n';
+            }
+
+            send(frame, len);
+            benchmark_left  -= len;
+            benchmark_bytes += len;
+        }
     }
 
-    void stop_transmission() {
-        i2c_stop_transmission();
-        serial_stop_transmission();
+    // Queues frames from the stream source while there's room for them
+    void stream_update() {
+        while (stream_source && (tx_len + BUFFER_SIZE * 2 + 2 <= TX_BUFFER_SIZE)) {
+            char frame[BUFFER_SIZE];
+            size_t len = _min(stream_source(frame, BUFFER_SIZE), (size_t)BUFFER_SIZE);
+
+            if (len == 0) {
+                stream_source = NULL;
+                break;
+            }
+
+            sendBytecode((const uint8_t*)frame, len);
+        }
     }
 
-    void transmit(char b) {
-        i2c_transmit(b);
-        serial_transmit(b);
+    // Queues a transmission that starts with the given request code
+    unsigned int queue(uint8_t start, const char* str, size_t len) {
+        // ! Truncate string to fit into buffer
+        if (len > BUFFER_SIZE) len = BUFFER_SIZE;
+
+        // ! Bytes that would be taken for requests are escaped, the rest might be compressed
+        static char encoded[BUFFER_SIZE * 2];
+        size_t encoded_len = encode(str, len, encoded);
+
+        // ! Wait until the queue has room for the whole transmission
+        unsigned long start_time = millis();
+
+        while (connection && (tx_len + encoded_len + 2 > TX_BUFFER_SIZE)) {
+            i2c_update();
+            serial_update();
+            transmit_pending();
+
+            if (millis() - start_time > TRANSMIT_TIMEOUT_MS) {
+                debugln("Transmission queue TIMEOUT ERROR");
+                connection = false;
+            }
+
+            delay(1);
+        }
+
+        if (!connection) return 0;
+
+        tx_buf[tx_len++] = start;
+        memcpy(&tx_buf[tx_len], encoded, encoded_len);
+        tx_len          += encoded_len;
+        tx_buf[tx_len++] = REQ_EOT;
+
+        debugf("Queued %u byte (%u encoded)\n", len, encoded_len);
+
+        transmit_pending();
+
+        // ! Return number of characters queued
+        return len;
     }
 
     // ===== PUBLIC ===== //
     void begin() {
-        status.version = 0;
-        status.wait    = 0;
-        status.repeat  = 0;
+        status.version  = 0;
+        status.wait     = 0;
+        status.repeat   = 0;
+        status.credit   = 0;
+        status.received = 0;
+        status.flags    = 0;
+        status.caps     = 0;
+        status.delay    = 0;
+
+        compression_begin();
 
         i2c_begin();
         serial_begin();
@@ -276,6 +648,10 @@ namespace com {
         i2c_update();
         serial_update();
 
+        benchmark_update();
+        stream_update();
+        transmit_pending();
+
         if (react_on_status) {
             react_on_status = false;
 
@@ -285,6 +661,16 @@ namespace com {
                 debugf("ERROR %u\n", status.version);
                 connection = false;
                 if (callback_error) callback_error();
+            } else if (abort_running) {
+                // Whatever was aborted must not trigger callbacks
+                if ((status.wait == 0) && (status.repeat == 0)) {
+                    abort_latency = millis() - abort_time;
+                    abort_running = false;
+                    debugf("ABORTED after %lu ms\n", abort_latency);
+                    if (callback_aborted) callback_aborted();
+                } else {
+                    debugf("ABORTING %u\n", status.wait);
+                }
             } else if (status.wait > 0) {
                 debugf("PROCESSING %u\n", status.wait);
             } else if (status.repeat > 0) {
@@ -292,7 +678,20 @@ namespace com {
                 if (callback_repeat) callback_repeat();
             } else if ((status.wait == 0) && (status.repeat == 0)) {
                 debugln("DONE");
-                if (callback_done) callback_done();
+                if (benchmark_running) {
+                    if (benchmark_left == 0) {
+                        benchmark_running = false;
+                        benchmark_time    = millis() - benchmark_start;
+                    }
+                } else if (stream_running) {
+                    // The ATmega can be idle in between frames, it's done when all of them arrived
+                    if (!stream_source && (tx_len == 0) && (in_flight() == 0)) {
+                        stream_running = false;
+                        if (callback_done) callback_done();
+                    }
+                } else if (callback_done) {
+                    callback_done();
+                }
             } else {
                 debugln("idk");
             }
@@ -308,47 +707,113 @@ namespace com {
     }
 
     unsigned int send(const char* str, size_t len) {
-        // ! Truncate string to fit into buffer
-        if (len > BUFFER_SIZE) len = BUFFER_SIZE;
+        return queue(REQ_SOT, str, len);
+    }
 
-        size_t sent = 0; // byte sent overall
-        size_t i    = 0; // index of string
-        size_t j    = 0; // byte sent for current packet
+    unsigned int sendBytecode(const uint8_t* code, size_t len) {
+        return queue(REQ_SOB, (const char*)code, len);
+    }
 
-        start_transmission();
+    void abort() {
+        if (!connection) return;
 
-        transmit(REQ_SOT);
+        // Whatever is still queued belongs to the aborted script
+        tx_len            = 0;
+        benchmark_running = false;
+        benchmark_left    = 0;
+        stream_running    = false;
+        stream_source     = NULL;
+
+        if (control(REQ_ABORT)) {
+            abort_running    = true;
+            abort_time       = millis();
+            new_transmission = true;
+        }
+    }
 
-        ++sent;
-        ++j;
+    void pause() {
+        control(REQ_PAUSE);
+        new_transmission = true;
+    }
 
-        while (i < len) {
-            char b = str[i];
-            
-            if ((b != '\n') && (b != '\n')) debug(b);
-            transmit(b);
-
-            ++i;
-            ++j;
-            ++sent;
-
-            if (j == PACKET_SIZE/*sent % PACKET_SIZE == 0*/) {
-                stop_transmission();
-                start_transmission();
-                j = 0;
-            }
-        }
+    void resume() {
+        control(REQ_RESUME);
+        new_transmission = true;
+    }
 
-        transmit(REQ_EOT);
+    bool paused() {
+        return status.flags & STATUS_PAUSED;
+    }
 
-        ++sent;
+    bool aborting() {
+        return abort_running;
+    }
 
-        stop_transmission();
+    unsigned long getAbortLatency() {
+        return abort_latency;
+    }
 
-        new_transmission = true;
+    bool startBenchmark(unsigned long len, com_source source) {
+        if (!connection || benchmark_running || stream_running || (tx_len > 0) || (len == 0)) return false;
+
+        benchmark_running = true;
+        benchmark_left    = len;
+        benchmark_bytes   = 0;
+        benchmark_link    = 0;
+        benchmark_source  = source;
+        benchmark_start   = millis();
+        benchmark_time    = 0;
+
+        benchmark_update();
+
+        return true;
+    }
+
+    bool stream(com_source source) {
+        if (!connection || benchmark_running || stream_running || !source) return false;
+
+        stream_running = true;
+        stream_source  = source;
 
-        // ! Return number of characters sent, minus 2 due to the signals
-        return sent-2;
+        stream_update();
+
+        return true;
+    }
+
+    bool streaming() {
+        return stream_running;
+    }
+
+    bool benchmarking() {
+        return benchmark_running;
+    }
+
+    unsigned long getBenchmark() {
+        if (benchmark_running || (benchmark_time == 0)) return 0;
+        return benchmark_bytes * 1000 / benchmark_time;
+    }
+
+    unsigned long getBenchmarkLink() {
+        if (benchmark_running || (benchmark_time == 0)) return 0;
+        return benchmark_link * 1000 / benchmark_time;
+    }
+
+    unsigned long transferTime(size_t len) {
+        // SOT/SOB and EOT, the status is read back once the frame is processed
+        len += 2 + STATUS_SIZE;
+
+        unsigned long link = getBenchmarkLink();
+
+        if (link > 0) return (uint64_t)len * 1000000UL / link;
+
+#ifdef ENABLE_I2C
+        // One address byte per packet, 9 clock cycles per byte including the ACK
+        len += (len + I2C_PACKET_SIZE - 1) / I2C_PACKET_SIZE + 1;
+        return (uint64_t)len * 9 * 1000000UL / I2C_CLOCK_SPEED;
+#else // ifdef ENABLE_I2C
+        // Start and stop bit
+        return (uint64_t)len * 10 * 1000000UL / SERIAL_BAUD;
+#endif // ifdef ENABLE_I2C
     }
 
     void onDone(com_callback c) {
@@ -363,6 +828,22 @@ namespace com {
         callback_error = c;
     }
 
+    void onAborted(com_callback c) {
+        callback_aborted = c;
+    }
+
+    unsigned int getWait() {
+        return status.wait;
+    }
+
+    unsigned int getDelay() {
+        return status.delay;
+    }
+
+    unsigned int getRepeats() {
+        return status.repeat;
+    }
+
     bool connected() {
         return connection;
     }
@@ -7,11 +7,19 @@
 
 #pragma once
 
+#include <stddef.h> // size_t, NULL
+#include <stdint.h> // uint8_t
+
 /*! \typedef com_callback
  *  \brief Callback function to react on different responses
  */
 typedef void (* com_callback)();
 
+/*! \typedef com_source
+ *  \brief Function that fills buf with up to len bytes and returns how many it wrote
+ */
+typedef size_t (* com_source)(char* buf, size_t len);
+
 /*! \namespace com
  *  \brief Communication module
  */
@@ -27,6 +35,51 @@ namespace com {
     unsigned int send(const char* str);
     unsigned int send(const char* str, unsigned int len);
 
+    /*! Transmits bytecode compiled by duckcompiler */
+    unsigned int sendBytecode(const uint8_t* code, unsigned int len);
+
+    /*! Keeps the ATmega's buffer full with bytecode frames from source until it returns 0,
+        done is called once all of them were processed */
+    bool stream(com_source source);
+
+    /*! Returns whether or not a stream is running */
+    bool streaming();
+
+    /*! Stops the ATmega immediately and drops everything that wasn't typed yet */
+    void abort();
+
+    /*! Holds typing on the ATmega at the next keystroke */
+    void pause();
+
+    /*! Continues typing after a pause */
+    void resume();
+
+    /*! Returns whether or not the ATmega is paused */
+    bool paused();
+
+    /*! Returns whether or not an abort is still in progress */
+    bool aborting();
+
+    /*! Returns the time from the last abort until the ATmega was idle in ms */
+    unsigned long getAbortLatency();
+
+    /*! Starts sending len bytes of comments to measure the throughput,
+        the comments come from source if given */
+    bool startBenchmark(unsigned long len, com_source source = NULL);
+
+    /*! Returns whether or not a benchmark is running */
+    bool benchmarking();
+
+    /*! Returns the result of the last benchmark in payload byte/s */
+    unsigned long getBenchmark();
+
+    /*! Returns the bytes/s that were actually transmitted during the last benchmark */
+    unsigned long getBenchmarkLink();
+
+    /*! Returns the estimated time in us to transmit a frame of len bytes and read the status after it,
+        at the speed of the last benchmark or the configured clock/baud rate */
+    unsigned long transferTime(size_t len);
+
     /*! Sets callback for status done */
     void onDone(com_callback c);
 
@@ -36,6 +89,18 @@ namespace com {
     /*! Sets callback for status repeat */
     void onRepeat(com_callback c);
 
+    /*! Sets callback for when the ATmega is idle after an abort */
+    void onAborted(com_callback c);
+
+    /*! Returns the bytes and delay the ATmega still has to process, the lowest bit toggles as heartbeat */
+    unsigned int getWait();
+
+    /*! Returns the remaining delay of the ATmega in ms */
+    unsigned int getDelay();
+
+    /*! Returns the remaining repetitions of the ATmega */
+    unsigned int getRepeats();
+
     /*! Returns state of connection */
     bool connected();
 
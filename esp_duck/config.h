@@ -22,9 +22,17 @@
 // #define I2C_SDA 4
 // #define I2C_SCL 5
 #define I2C_CLOCK_SPEED 100000L
+// #define I2C_READY_PIN 14 // Optional, ATmega signals when a new status is ready
 
 #define BUFFER_SIZE 256
-#define PACKET_SIZE 32
+#define HISTORY_SIZE 2048 // Bytes reserved for recently sent lines, used by REPEAT
+#define FLOW_SIZE 64      // VAR, IF, WHILE, FUNCTION, ... statements per script
+#define JOBS_SIZE 8       // Scripts that can wait in the job queue
+#define CACHE_SIZE 16384  // Bytes a cached run of a script can take, longer runs aren't cached
+
+#define ENABLE_COMPRESSION // Compress transmissions when the ATmega supports it
+#define ENABLE_COALESCING  // Send consecutive STRING/STRINGLN lines in one frame
+#define ENABLE_CACHE       // Run unchanged scripts from a recording of their first run
 
 #define MSG_CONNECTED "LED 0 0 25\n"
 #define MSG_STARTED "LED 0 25 0\n"
@@ -34,6 +42,13 @@
 #define EEPROM_BOOT_ADDR  3210
 #define BOOT_MAGIC_NUM    1234567890
 
+/*! ===== Storage Settings ===== */
+// #define ENABLE_LITTLEFS // Store files in LittleFS instead of SPIFFS, SPIFFS files are moved over once
+#define FILES_SIZE 128 // Files whose name and size are kept in RAM for ls, with more they are read from flash
+#define RAMDISK_SIZE 8192 // Bytes of RAM for files in /ram/
+#define RAMDISK_FILES 8   // Files in /ram/, scripts take two with their index
+// #define ENABLE_FILE_COMPRESSION // Compress scripts after they were written, they are decompressed while they are read
+
 /*! ===== WiFi Settings ===== */
 #define WIFI_SSID "wifiduck"
 #define WIFI_PASSWORD "wifiduck"
@@ -62,6 +77,10 @@
 #error SDA pin equals to SCL pin
 #endif /* if !defined(ENABLE_I2C) && !defined(ENABLE_I2C) */
 
+#if defined(I2C_READY_PIN) && (I2C_READY_PIN==16 || I2C_READY_PIN==I2C_SDA || I2C_READY_PIN==I2C_SCL)
+#error I2C ready pin must be interrupt capable (not GPIO 16) and not an I2C pin
+#endif /* if defined(I2C_READY_PIN) */
+
 #if defined(ENABLE_I2C) && defined(ENABLE_SERIAL) && (I2C_SDA==1 || I2C_SDA==3 || I2C_SCL==1 || I2C_SCL==3)
 #error I2C pins overlap with RX and TX pins. Disable serial debugging or change the I2C pins.
 #endif /* if !defined(ENABLE_I2C) && !defined(ENABLE_I2C) */
\ No newline at end of file
@@ -0,0 +1,386 @@
+/*
+   This software is licensed under the MIT License. See the license file for details.
+   Source: https://github.com/spacehuhntech/WiFiDuck
+ */
+
+#include "duckcompiler.h"
+
+#include <string.h>  // memchr, memcmp, strlen
+#include <strings.h> // strncasecmp
+
+namespace duckcompiler {
+    // ===== PRIVATE ===== //
+    typedef struct keyword_t {
+        const char* name;
+        uint8_t     code;
+    } keyword_t;
+
+    // Key names and their HID usage, as in atmega_duck/usb_hid_keys.h
+    const keyword_t keys[] = {
+        { "ENTER", 0x28 },
+        { "MENU", 0x76 },
+        { "APP", 0x76 },
+        { "DELETE", 0x4c },
+        { "BACKSPACE", 0x2a },
+        { "HOME", 0x4a },
+        { "INSERT", 0x49 },
+        { "PAGEUP", 0x4b },
+        { "PAGEDOWN", 0x4e },
+        { "UPARROW", 0x52 },
+        { "UP", 0x52 },
+        { "DOWNARROW", 0x51 },
+        { "DOWN", 0x51 },
+        { "LEFTARROW", 0x50 },
+        { "LEFT", 0x50 },
+        { "RIGHTARROW", 0x4f },
+        { "RIGHT", 0x4f },
+        { "TAB", 0x2b },
+        { "END", 0x4d },
+        { "ESC", 0x29 },
+        { "ESCAPE", 0x29 },
+        { "F1", 0x3a },
+        { "F2", 0x3b },
+        { "F3", 0x3c },
+        { "F4", 0x3d },
+        { "F5", 0x3e },
+        { "F6", 0x3f },
+        { "F7", 0x40 },
+        { "F8", 0x41 },
+        { "F9", 0x42 },
+        { "F10", 0x43 },
+        { "F11", 0x44 },
+        { "F12", 0x45 },
+        { "SPACE", 0x2c },
+        { "PAUSE", 0x48 },
+        { "BREAK", 0x48 },
+        { "CAPSLOCK", 0x39 },
+        { "NUMLOCK", 0x53 },
+        { "PRINTSCREEN", 0x46 },
+        { "SCROLLLOCK", 0x47 },
+        { "NUM_0", 0x62 },
+        { "NUM_1", 0x59 },
+        { "NUM_2", 0x5a },
+        { "NUM_3", 0x5b },
+        { "NUM_4", 0x5c },
+        { "NUM_5", 0x5d },
+        { "NUM_6", 0x5e },
+        { "NUM_7", 0x5f },
+        { "NUM_8", 0x60 },
+        { "NUM_9", 0x61 },
+        { "NUM_ASTERIX", 0x55 },
+        { "NUM_ENTER", 0x58 },
+        { "NUM_MINUS", 0x56 },
+        { "NUM_DOT", 0x63 },
+        { "NUM_PLUS", 0x57 },
+    };
+
+    const keyword_t modifiers[] = {
+        { "CTRL", 0x01 },
+        { "CONTROL", 0x01 },
+        { "SHIFT", 0x02 },
+        { "ALT", 0x04 },
+        { "WINDOWS", 0x08 },
+        { "GUI", 0x08 },
+    };
+
+    // Same order as the locales in atmega_duck/duckparser.cpp
+    const char* locales[] = {
+        "US", "DE", "RU", "GB", "ES", "FR", "DK", "BE", "PT",
+        "IT", "SK", "CZ", "SI", "BG", "CA-FR", "CH-DE", "CH-FR", "HU",
+    };
+
+#define KEYS_LEN (sizeof(keys) / sizeof(keyword_t))
+#define MODIFIERS_LEN (sizeof(modifiers) / sizeof(keyword_t))
+#define LOCALES_LEN (sizeof(locales) / sizeof(const char*))
+
+    typedef struct writer_t {
+        uint8_t* buf;
+        size_t   size;
+        size_t   len;
+        bool     overflow;
+    } writer_t;
+
+    void put(writer_t& w, uint8_t b) {
+        if (w.len < w.size) w.buf[w.len++] = b;
+        else w.overflow = true;
+    }
+
+    void putVarint(writer_t& w, uint32_t val) {
+        while (val >= 0x80) {
+            put(w, (val & 0x7F) | 0x80);
+            val >>= 7;
+        }
+        put(w, val);
+    }
+
+    void putString(writer_t& w, const char* str, size_t len) {
+        putVarint(w, len);
+        for (size_t i = 0; i < len; ++i) put(w, str[i]);
+    }
+
+    bool equals(const char* str, size_t len, const char* keyword) {
+        return strlen(keyword) == len && memcmp(str, keyword, len) == 0;
+    }
+
+    int find(const keyword_t* list, size_t list_len, const char* str, size_t len) {
+        for (size_t i = 0; i < list_len; ++i) {
+            if (equals(str, len, list[i].name)) return i;
+        }
+        return -1;
+    }
+
+    // Splits like parse_words() on the ATmega, lines with quotes or escapes aren't compiled
+    bool nextWord(const char* str, size_t len, size_t& i, const char*& word, size_t& word_len) {
+        while (i < len && str[i] == ' ') ++i;
+
+        if (i >= len) return false;
+
+        size_t start = i;
+
+        while (i < len && str[i] != ' ') ++i;
+
+        word     = &str[start];
+        word_len = i - start;
+
+        return true;
+    }
+
+    // Same as duckparser::toInt() on the ATmega
+    uint32_t toInt(const char* str, size_t len) {
+        if (!str || (len == 0)) return 0;
+
+        uint32_t val = 0;
+
+        // HEX
+        if ((len > 2) && (str[0] == '0') && (str[1] == 'x')) {
+            for (size_t i = 2; i < len; ++i) {
+                uint8_t b = str[i];
+
+                if ((b >= '0') && (b <= '9')) b = b - '0';
+                else if ((b >= 'a') && (b <= 'f')) b = b - 'a' + 10;
+                else if ((b >= 'A') && (b <= 'F')) b = b - 'A' + 10;
+
+                val = (val << 4) | (b & 0xF);
+            }
+        }
+        // DECIMAL
+        else {
+            for (size_t i = 0; i < len; ++i) {
+                if ((str[i] >= '0') && (str[i] <= '9')) {
+                    val = val * 10 + (str[i] - '0');
+                }
+            }
+        }
+
+        return val;
+    }
+
+    // ===== PUBLIC ===== //
+    bool typing(const uint8_t* code, size_t len) {
+        return (len > 0) && ((code[0] == OP_STRING) || (code[0] == OP_STRINGLN));
+    }
+
+    line_type classify(const char* line, size_t len, uint32_t* value) {
+        bool complete = (len > 0) && (line[len-1] == '\n');
+
+        while (len > 0 && (line[len-1] == '\n' || line[len-1] == '\r')) --len;
+
+        if (len == 0) return complete ? LINE_EMPTY : LINE_OTHER;
+        if (line[0] == ' ') return LINE_OTHER;
+
+        size_t i = 0;
+        const char* cmd;
+        size_t cmd_len;
+
+        nextWord(line, len, i, cmd, cmd_len);
+
+        // A comment can be longer than a chunk
+        if (equals(cmd, cmd_len, "REM")) return LINE_COMMENT;
+
+        if (!complete) return LINE_OTHER;
+
+        if (equals(line, len, "STRING_BLOCK")) return LINE_BLOCK;
+        if (equals(cmd, cmd_len, "TYPEFILE")) return LINE_FILE;
+
+        if (equals(cmd, cmd_len, "DELAY")) {
+            *value = toInt(cmd + cmd_len + 1, len > cmd_len ? len - cmd_len - 1 : 0);
+            return LINE_DELAY;
+        }
+
+        if (equals(cmd, cmd_len, "DEFAULTDELAY") || equals(cmd, cmd_len, "DEFAULT_DELAY") ||
+            equals(cmd, cmd_len, "DEFAULT_STRING_DELAY") || equals(cmd, cmd_len, "DEFAULTSTRINGDELAY") ||
+            equals(cmd, cmd_len, "STRING_DELAY") || equals(cmd, cmd_len, "STRINGDELAY") ||
+            equals(cmd, cmd_len, "STRING_DELAY_RANDOM") || equals(cmd, cmd_len, "LOCALE")) {
+            return LINE_SETTING;
+        }
+
+        return LINE_OTHER;
+    }
+
+    size_t compileText(const char* str, size_t len, uint8_t* code, size_t size) {
+        writer_t w { code, size, 0, false };
+
+        put(w, OP_TYPE);
+        putString(w, str, len);
+
+        return w.overflow ? 0 : w.len;
+    }
+
+    size_t compile(const char* line, size_t len, uint8_t* code, size_t size) {
+        // Only complete lines, the rest of a long line is sent as text
+        if ((len == 0) || (line[len-1] != '\n')) return 0;
+
+        while (len > 0 && (line[len-1] == '\n' || line[len-1] == '\r')) --len;
+
+        // Empty lines and anything the ATmega would split into more than one line
+        if ((len == 0) || (line[0] == ' ') ||
+            memchr(line, '\r', len) || memchr(line, '\n', len) || memchr(line, '\0', len)) return 0;
+
+        // Quotes and escapes change how the ATmega splits words
+        bool plain = !memchr(line, '"', len) && !memchr(line, '\\', len);
+
+        size_t i = 0;
+        const char* cmd;
+        size_t cmd_len;
+
+        nextWord(line, len, i, cmd, cmd_len);
+
+        const char* args   = cmd + cmd_len + 1;
+        size_t args_len    = len > cmd_len ? len - cmd_len - 1 : 0;
+        const char* word   = NULL;
+        size_t word_len    = 0;
+        size_t args_i      = 0;
+
+        writer_t w { code, size, 0, false };
+
+        // REM (-> the ATmega keeps track of comments)
+        if (equals(cmd, cmd_len, "REM")) {
+            return 0;
+        }
+
+        // LOCALE
+        else if (equals(cmd, cmd_len, "LOCALE")) {
+            if (!plain || !nextWord(args, args_len, args_i, word, word_len)) return 0;
+
+            size_t l = 0;
+            while (l < LOCALES_LEN && !(strlen(locales[l]) == word_len && strncasecmp(word, locales[l], word_len) == 0)) ++l;
+
+            if (l == LOCALES_LEN) return 0;
+
+            put(w, OP_LOCALE);
+            put(w, l);
+        }
+
+        // DELAY
+        else if (equals(cmd, cmd_len, "DELAY")) {
+            put(w, OP_DELAY);
+            putVarint(w, toInt(args, args_len));
+        }
+
+        // DEFAULTDELAY/DEFAULT_DELAY
+        else if (equals(cmd, cmd_len, "DEFAULTDELAY") || equals(cmd, cmd_len, "DEFAULT_DELAY")) {
+            put(w, OP_DEFAULT_DELAY);
+            putVarint(w, toInt(args, args_len));
+        }
+
+        // DEFAULT_STRING_DELAY/DEFAULTSTRINGDELAY/STRING_DELAY/STRINGDELAY
+        else if (equals(cmd, cmd_len, "DEFAULT_STRING_DELAY") || equals(cmd, cmd_len, "DEFAULTSTRINGDELAY") ||
+                 equals(cmd, cmd_len, "STRING_DELAY") || equals(cmd, cmd_len, "STRINGDELAY")) {
+            if (!plain || !nextWord(args, args_len, args_i, word, word_len)) return 0;
+
+            put(w, OP_STRING_DELAY);
+            putVarint(w, toInt(word, word_len));
+        }
+
+        // STRING_DELAY_RANDOM
+        else if (equals(cmd, cmd_len, "STRING_DELAY_RANDOM")) {
+            if (!plain || !nextWord(args, args_len, args_i, word, word_len)) return 0;
+            uint32_t min = toInt(word, word_len);
+
+            if (!nextWord(args, args_len, args_i, word, word_len)) return 0;
+            uint32_t max = toInt(word, word_len);
+
+            if (max < min) return 0;
+
+            put(w, OP_STRING_DELAY_RANDOM);
+            putVarint(w, min);
+            putVarint(w, max);
+        }
+
+        // REPEAT/REPLAY
+        else if (equals(cmd, cmd_len, "REPEAT") || equals(cmd, cmd_len, "REPLAY")) {
+            put(w, OP_REPEAT);
+            putVarint(w, toInt(args, args_len));
+        }
+
+        // STRING
+        else if (equals(cmd, cmd_len, "STRING")) {
+            put(w, OP_STRING);
+            putString(w, args, args_len);
+        }
+
+        // STRINGLN
+        else if (equals(cmd, cmd_len, "STRINGLN")) {
+            put(w, OP_STRINGLN);
+            putString(w, args, args_len);
+        }
+
+        // LED
+        else if (equals(cmd, cmd_len, "LED")) {
+            if (!plain) return 0;
+
+            put(w, OP_LED);
+
+            for (uint8_t c = 0; c < 3; ++c) {
+                if (nextWord(args, args_len, args_i, word, word_len)) putVarint(w, toInt(word, word_len));
+                else putVarint(w, 0);
+            }
+        }
+
+        // KEYCODE
+        else if (equals(cmd, cmd_len, "KEYCODE")) {
+            if (!plain) return 0;
+
+            uint8_t k[7];
+            uint8_t n = 0;
+
+            while (n < 7 && nextWord(args, args_len, args_i, word, word_len)) {
+                k[n++] = (uint8_t)toInt(word, word_len);
+            }
+
+            put(w, OP_KEYCODE);
+            putVarint(w, n);
+            for (uint8_t j = 0; j < n; ++j) put(w, k[j]);
+        }
+
+        // Otherwise look for keys to press
+        else {
+            if (!plain) return 0;
+
+            i = 0;
+
+            while (nextWord(line, len, i, word, word_len)) {
+                int k = word_len > 1 ? find(keys, KEYS_LEN, word, word_len) : -1;
+                int m = word_len > 1 ? find(modifiers, MODIFIERS_LEN, word, word_len) : -1;
+
+                if (k >= 0) {
+                    put(w, OP_KEY);
+                    put(w, keys[k].code);
+                } else if (m >= 0) {
+                    put(w, OP_MODIFIER);
+                    put(w, modifiers[m].code);
+                } else {
+                    // Single characters and UTF-8, translated with the ATmega's keyboard layout
+                    put(w, OP_PRESS);
+                    putString(w, word, word_len);
+                }
+            }
+
+            put(w, OP_RELEASE);
+        }
+
+        if (w.overflow) return 0;
+
+        return w.len;
+    }
+}
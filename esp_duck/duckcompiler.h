@@ -0,0 +1,51 @@
+/*
+   This software is licensed under the MIT License. See the license file for details.
+   Source: https://github.com/spacehuhntech/WiFiDuck
+ */
+
+#pragma once
+
+#include <stddef.h> // size_t
+#include <stdint.h> // uint8_t
+
+// ! Bytecode executed by the ATmega, numbers and lengths are varints (7 bit per byte, LSB first)
+#define OP_STRING 0x80              // !< len, UTF-8 bytes
+#define OP_STRINGLN 0x81            // !< len, UTF-8 bytes
+#define OP_DELAY 0x82               // !< ms
+#define OP_DEFAULT_DELAY 0x83       // !< ms
+#define OP_STRING_DELAY 0x84        // !< ms
+#define OP_STRING_DELAY_RANDOM 0x85 // !< min ms, max ms
+#define OP_REPEAT 0x86              // !< n
+#define OP_LOCALE 0x87              // !< index into locales (byte)
+#define OP_LED 0x88                 // !< r, g, b
+#define OP_KEYCODE 0x89             // !< n, n bytes (modifiers, up to 6 keys)
+#define OP_KEY 0x8A                 // !< HID usage (byte)
+#define OP_MODIFIER 0x8B            // !< modifier mask (byte)
+#define OP_PRESS 0x8C               // !< len, UTF-8 character
+#define OP_RELEASE 0x8D             // !< releases all keys
+#define OP_TYPE 0x8E                // !< len, UTF-8 bytes, part of a longer text
+
+namespace duckcompiler {
+    typedef enum line_type {
+        LINE_OTHER,   // Sent to the ATmega
+        LINE_EMPTY,
+        LINE_COMMENT, // REM
+        LINE_DELAY,
+        LINE_SETTING, // DEFAULTDELAY, STRING_DELAY, LOCALE, ...
+        LINE_BLOCK,   // STRING_BLOCK, the lines up to END_STRING are typed as they are
+        LINE_FILE     // TYPEFILE, a file is typed as it is
+    } line_type;
+
+    // Tells what the start of a line does, value is set to the time of a DELAY
+    line_type classify(const char* line, size_t len, uint32_t* value);
+
+    // Returns whether compiled code only types a string (STRING/STRINGLN)
+    bool typing(const uint8_t* code, size_t len);
+
+    // Compiles text that is typed as it is, including line breaks.
+    // Returns the size of the bytecode, or 0 if it doesn't fit.
+    size_t compileText(const char* str, size_t len, uint8_t* code, size_t size);
+
+    // Returns the size of the bytecode, or 0 if the line has to be sent as text
+    size_t compile(const char* line, size_t len, uint8_t* code, size_t size);
+};
@@ -0,0 +1,734 @@
+/*
+   This software is licensed under the MIT License. See the license file for details.
+   Source: https://github.com/spacehuhntech/WiFiDuck
+ */
+
+#include "duckflow.h"
+
+#include "config.h"
+#include "debug.h"
+
+#include "lineindex.h" // hash()
+#include "spiffs.h"
+
+#define FLOW_VARS 16
+#define FLOW_FUNCTIONS 16
+#define FLOW_DEPTH 8       // Nested blocks and calls
+#define FLOW_CODE_SIZE 512 // Compiled expressions
+#define FLOW_LINE_SIZE 128 // Longest statement
+#define FLOW_STACK 16      // Values and operators of an expression
+#define FLOW_NONE 0xFFFF
+
+namespace duckflow {
+    // ===== PRIVATE ===== //
+    typedef enum op_t {
+        FLOW_SET,
+        FLOW_IF,
+        FLOW_ELSE_IF,
+        FLOW_ELSE,
+        FLOW_END_IF,
+        FLOW_WHILE,
+        FLOW_END_WHILE,
+        FLOW_FUNCTION,
+        FLOW_END_FUNCTION,
+        FLOW_RETURN,
+        FLOW_CALL
+    } op_t;
+
+    typedef struct statement_t {
+        uint32_t line;
+        uint32_t offset; // Byte offset of the line
+        uint32_t after;  // Byte offset of the line after it
+        uint16_t next;   // IF/ELSE IF: next branch, END_WHILE: its WHILE, CALL: the FUNCTION
+        uint16_t end;    // IF/ELSE IF/ELSE: END_IF, WHILE: END_WHILE, FUNCTION: END_FUNCTION
+        uint16_t expr;   // Position of the expression in code
+        uint8_t  op;
+        uint8_t  var;
+    } statement_t;
+
+    // Sorted by line
+    statement_t statements[FLOW_SIZE];
+    size_t statementsLen { 0 };
+
+    // Expressions in postfix order, each one ends with X_END
+    typedef enum expr_op_t {
+        X_END,
+        X_NUM, // 4 bytes
+        X_VAR, // Variable (byte)
+        X_NOT,
+        X_NEG,
+        X_OR,
+        X_AND,
+        X_BOR,
+        X_BAND,
+        X_EQ,
+        X_NE,
+        X_LT,
+        X_LE,
+        X_GT,
+        X_GE,
+        X_SHL,
+        X_SHR,
+        X_ADD,
+        X_SUB,
+        X_MUL,
+        X_DIV,
+        X_MOD,
+        X_PAREN // Only on the operator stack while compiling
+    } expr_op_t;
+
+    typedef struct operator_t {
+        const char* str;
+        uint8_t     op;
+        uint8_t     precedence;
+    } operator_t;
+
+    // Longer operators first, so <= isn't read as <
+    const operator_t operators[] = {
+        { "||", X_OR, 1 },
+        { "&&", X_AND, 2 },
+        { "==", X_EQ, 5 },
+        { "!=", X_NE, 5 },
+        { "<=", X_LE, 6 },
+        { ">=", X_GE, 6 },
+        { "<<", X_SHL, 7 },
+        { ">>", X_SHR, 7 },
+        { "|", X_BOR, 3 },
+        { "&", X_BAND, 4 },
+        { "<", X_LT, 6 },
+        { ">", X_GT, 6 },
+        { "+", X_ADD, 8 },
+        { "-", X_SUB, 8 },
+        { "*", X_MUL, 9 },
+        { "/", X_DIV, 9 },
+        { "%", X_MOD, 9 },
+    };
+
+#define OPERATORS_LEN (sizeof(operators) / sizeof(operator_t))
+#define UNARY_PRECEDENCE 10
+
+    uint8_t code[FLOW_CODE_SIZE];
+    size_t  codeLen { 0 };
+    bool    codeOverflow { false };
+
+    // Names are kept as hashes
+    uint32_t varNames[FLOW_VARS];
+    int32_t  vars[FLOW_VARS];
+    size_t   varsLen { 0 };
+
+    uint32_t functionNames[FLOW_FUNCTIONS];
+    uint16_t functions[FLOW_FUNCTIONS]; // FUNCTION statements
+    size_t   functionsLen { 0 };
+
+    // Blocks that are still open while compiling
+    uint16_t blocks[FLOW_DEPTH];
+    size_t   blocksLen { 0 };
+
+    // CALL statements to return to
+    uint16_t calls[FLOW_DEPTH];
+    size_t   callsLen { 0 };
+
+    bool fail(size_t line, const char* msg) {
+        debugf("Line %u: %s\n", line + 1, msg);
+        return false;
+    }
+
+    bool isSpace(char c) {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    bool isName(char c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+    }
+
+    void trim(const char*& str, size_t& len) {
+        while (len > 0 && isSpace(str[0])) {
+            ++str;
+            --len;
+        }
+        while (len > 0 && isSpace(str[len-1])) --len;
+    }
+
+    // Skips a keyword that is followed by a space or the end of the line
+    bool keyword(const char*& str, size_t& len, const char* word) {
+        size_t n = strlen(word);
+
+        if ((len < n) || (memcmp(str, word, n) != 0) || ((len > n) && !isSpace(str[n]))) return false;
+
+        str += n;
+        len -= n;
+        trim(str, len);
+
+        return true;
+    }
+
+    // Length of a variable or function name
+    size_t name(const char* str, size_t len) {
+        size_t n = 0;
+        while (n < len && isName(str[n])) ++n;
+        return n;
+    }
+
+    int findName(const uint32_t* names, size_t names_len, uint32_t hash) {
+        for (size_t i = 0; i < names_len; ++i) {
+            if (names[i] == hash) return i;
+        }
+        return -1;
+    }
+
+    int findVar(const char* str, size_t len, bool declare) {
+        uint32_t hash = lineindex::hash(HASH_INIT, str, len);
+        int i         = findName(varNames, varsLen, hash);
+
+        if ((i >= 0) || !declare || (varsLen == FLOW_VARS)) return i;
+
+        varNames[varsLen] = hash;
+        vars[varsLen]     = 0;
+
+        return varsLen++;
+    }
+
+    void put(uint8_t b) {
+        if (codeLen < FLOW_CODE_SIZE) code[codeLen++] = b;
+        else codeOverflow = true;
+    }
+
+    uint8_t precedence(uint8_t op) {
+        if ((op == X_NOT) || (op == X_NEG)) return UNARY_PRECEDENCE;
+
+        for (size_t i = 0; i < OPERATORS_LEN; ++i) {
+            if (operators[i].op == op) return operators[i].precedence;
+        }
+        return 0;
+    }
+
+    // Writes an operator and keeps track of how many values it leaves on the stack
+    bool emit(uint8_t op, size_t& depth) {
+        size_t args = (op == X_NOT || op == X_NEG) ? 1 : 2;
+
+        if (depth < args) return false;
+
+        depth -= args - 1;
+        put(op);
+
+        return true;
+    }
+
+    // Compiles an expression, returns its position in code or FLOW_NONE
+    uint16_t expression(const char* str, size_t len) {
+        uint16_t start   = codeLen;
+        uint8_t  ops[FLOW_STACK];
+        size_t   opsLen  = 0;
+        size_t   depth   = 0;    // Values on the stack when it runs
+        bool     operand = true; // An operand is expected next
+        size_t   i       = 0;
+
+        while (true) {
+            while (i < len && isSpace(str[i])) ++i;
+            if (i >= len) break;
+
+            char c = str[i];
+
+            if (operand) {
+                if ((c == '(') || (c == '!') || (c == '-')) {
+                    if (opsLen == FLOW_STACK) return FLOW_NONE;
+                    ops[opsLen++] = c == '(' ? X_PAREN : c == '!' ? X_NOT : X_NEG;
+                    ++i;
+                    continue;
+                }
+
+                int32_t val;
+                size_t  n = name(&str[i], len - i);
+
+                if (c == '$') {
+                    n = name(&str[i+1], len - i - 1);
+                    int v = n > 0 ? findVar(&str[i+1], n, false) : -1;
+
+                    if (v < 0) return FLOW_NONE;
+
+                    put(X_VAR);
+                    put(v);
+                    i += n + 1;
+                } else if ((n == 4) && (memcmp(&str[i], "TRUE", 4) == 0)) {
+                    val = 1;
+                } else if ((n == 5) && (memcmp(&str[i], "FALSE", 5) == 0)) {
+                    val = 0;
+                } else if ((c >= '0') && (c <= '9')) {
+                    uint32_t u = 0;
+
+                    if ((n > 2) && (c == '0') && (str[i+1] == 'x')) {
+                        for (size_t j = 2; j < n; ++j) {
+                            char h = str[i+j];
+                            if ((h >= '0') && (h <= '9')) u = (u << 4) | (h - '0');
+                            else if ((h >= 'a') && (h <= 'f')) u = (u << 4) | (h - 'a' + 10);
+                            else if ((h >= 'A') && (h <= 'F')) u = (u << 4) | (h - 'A' + 10);
+                            else return FLOW_NONE;
+                        }
+                    } else {
+                        for (size_t j = 0; j < n; ++j) {
+                            if ((str[i+j] < '0') || (str[i+j] > '9')) return FLOW_NONE;
+                            u = u * 10 + (str[i+j] - '0');
+                        }
+                    }
+                    val = u;
+                } else {
+                    return FLOW_NONE;
+                }
+
+                if (c != '$') {
+                    put(X_NUM);
+                    for (size_t j = 0; j < sizeof(val); ++j) put(((uint8_t*)&val)[j]);
+                    i += n;
+                }
+
+                if (++depth > FLOW_STACK) return FLOW_NONE;
+                operand = false;
+            } else if (c == ')') {
+                while (opsLen > 0 && ops[opsLen-1] != X_PAREN) {
+                    if (!emit(ops[--opsLen], depth)) return FLOW_NONE;
+                }
+                if (opsLen == 0) return FLOW_NONE;
+
+                --opsLen;
+                ++i;
+            } else {
+                size_t o = 0;
+
+                while (o < OPERATORS_LEN && strncmp(&str[i], operators[o].str, strlen(operators[o].str)) != 0) ++o;
+
+                if (o == OPERATORS_LEN) return FLOW_NONE;
+
+                // Left to right, unary operators bind first
+                while (opsLen > 0 && ops[opsLen-1] != X_PAREN &&
+                       precedence(ops[opsLen-1]) >= operators[o].precedence) {
+                    if (!emit(ops[--opsLen], depth)) return FLOW_NONE;
+                }
+
+                if (opsLen == FLOW_STACK) return FLOW_NONE;
+
+                ops[opsLen++] = operators[o].op;
+                i            += strlen(operators[o].str);
+                operand       = true;
+            }
+        }
+
+        if (operand) return FLOW_NONE;
+
+        while (opsLen > 0) {
+            if ((ops[opsLen-1] == X_PAREN) || !emit(ops[--opsLen], depth)) return FLOW_NONE;
+        }
+
+        put(X_END);
+
+        if (codeOverflow || (depth != 1)) return FLOW_NONE;
+
+        return start;
+    }
+
+    int32_t eval(uint16_t pos) {
+        int32_t stack[FLOW_STACK];
+        size_t  n = 0;
+
+        while (code[pos] != X_END) {
+            uint8_t op = code[pos++];
+
+            if (op == X_NUM) {
+                memcpy(&stack[n++], &code[pos], sizeof(int32_t));
+                pos += sizeof(int32_t);
+            } else if (op == X_VAR) {
+                stack[n++] = vars[code[pos++]];
+            } else if (op == X_NOT) {
+                stack[n-1] = !stack[n-1];
+            } else if (op == X_NEG) {
+                stack[n-1] = 0U - (uint32_t)stack[n-1];
+            } else {
+                int32_t  b = stack[--n];
+                int32_t& a = stack[n-1];
+
+                switch (op) {
+                    case X_OR: a = a || b; break;
+                    case X_AND: a = a && b; break;
+                    case X_BOR: a = a | b; break;
+                    case X_BAND: a = a & b; break;
+                    case X_EQ: a = a == b; break;
+                    case X_NE: a = a != b; break;
+                    case X_LT: a = a < b; break;
+                    case X_LE: a = a <= b; break;
+                    case X_GT: a = a > b; break;
+                    case X_GE: a = a >= b; break;
+                    case X_SHL: a = (uint32_t)a << (b & 31); break;
+                    case X_SHR: a = a >> (b & 31); break;
+                    case X_ADD: a = (uint32_t)a + (uint32_t)b; break;
+                    case X_SUB: a = (uint32_t)a - (uint32_t)b; break;
+                    case X_MUL: a = (uint32_t)a * (uint32_t)b; break;
+                    case X_DIV: a = (b == 0) ? 0 : (b == -1) ? 0U - (uint32_t)a : a / b; break;
+                    case X_MOD: a = (b == 0 || b == -1) ? 0 : a % b; break;
+                }
+            }
+        }
+
+        return n > 0 ? stack[0] : 0;
+    }
+
+    // Reads "$name = expression"
+    bool assignment(const char* str, size_t len, bool declare, statement_t& s) {
+        if ((len == 0) || (str[0] != '$')) return fail(s.line, "Expected a variable");
+
+        size_t n = name(str + 1, len - 1);
+        int    v = n > 0 ? findVar(str + 1, n, declare) : -1;
+
+        if (v < 0) return fail(s.line, declare ? "Too many variables" : "Unknown variable");
+
+        str += n + 1;
+        len -= n + 1;
+        trim(str, len);
+
+        if ((len < 2) || (str[0] != '=') || (str[1] == '=')) return fail(s.line, "Expected =");
+
+        s.var  = v;
+        s.expr = expression(str + 1, len - 1);
+
+        return s.expr != FLOW_NONE || fail(s.line, "Invalid expression");
+    }
+
+    // Reads the condition of IF, ELSE IF and WHILE, THEN at the end is optional
+    bool condition(const char* str, size_t len, statement_t& s) {
+        if ((len >= 4) && (memcmp(&str[len-4], "THEN", 4) == 0) &&
+            ((len == 4) || isSpace(str[len-5]) || (str[len-5] == ')'))) {
+            len -= 4;
+        }
+
+        s.expr = len > 0 ? expression(str, len) : FLOW_NONE;
+
+        return s.expr != FLOW_NONE || fail(s.line, "Invalid condition");
+    }
+
+    // Connects a statement to the blocks around it
+    bool add(statement_t& s) {
+        if (statementsLen == FLOW_SIZE) return fail(s.line, "Too many statements");
+
+        uint16_t idx = statementsLen;
+        int      top = blocksLen > 0 ? blocks[blocksLen-1] : -1;
+        uint8_t  top_op = top >= 0 ? statements[top].op : FLOW_SET;
+
+        switch (s.op) {
+            case FLOW_IF:
+            case FLOW_WHILE:
+            case FLOW_FUNCTION:
+                if (blocksLen == FLOW_DEPTH) return fail(s.line, "Too many nested blocks");
+                blocks[blocksLen++] = idx;
+                break;
+
+            case FLOW_ELSE_IF:
+            case FLOW_ELSE:
+                if ((top_op != FLOW_IF) && (top_op != FLOW_ELSE_IF)) return fail(s.line, "ELSE without IF");
+
+                // The branches are chained, each one remembers the IF until END_IF is known
+                statements[top].next = idx;
+                s.end                = top_op == FLOW_IF ? top : statements[top].end;
+                blocks[blocksLen-1]  = idx;
+                break;
+
+            case FLOW_END_IF: {
+                if ((top_op != FLOW_IF) && (top_op != FLOW_ELSE_IF) && (top_op != FLOW_ELSE)) return fail(s.line, "END_IF without IF");
+
+                if (top_op != FLOW_ELSE) statements[top].next = idx;
+
+                uint16_t i = top_op == FLOW_IF ? top : statements[top].end;
+
+                while (true) {
+                    uint16_t next = statements[i].next;
+                    statements[i].end = idx;
+                    if (i == top) break;
+                    i = next;
+                }
+
+                --blocksLen;
+                break;
+            }
+
+            case FLOW_END_WHILE:
+                if (top_op != FLOW_WHILE) return fail(s.line, "END_WHILE without WHILE");
+
+                statements[top].end = idx;
+                s.next              = top;
+                --blocksLen;
+                break;
+
+            case FLOW_END_FUNCTION:
+                if (top_op != FLOW_FUNCTION) return fail(s.line, "END_FUNCTION without FUNCTION");
+
+                statements[top].end = idx;
+                --blocksLen;
+                break;
+
+            case FLOW_RETURN:
+                if ((blocksLen == 0) || (statements[blocks[0]].op != FLOW_FUNCTION)) return fail(s.line, "RETURN outside of a FUNCTION");
+                break;
+        }
+
+        statements[statementsLen++] = s;
+
+        return true;
+    }
+
+    // Text between STRING_BLOCK and END_STRING is typed, none of it is a statement.
+    // Returns true if the line is part of a block, like duckscript reads it
+    bool blockLine(const char* str, size_t len, bool& inBlock) {
+        while (len > 0 && str[len-1] == '\r') --len;
+
+        const char* word = inBlock ? "END_STRING" : "STRING_BLOCK";
+        size_t n         = strlen(word);
+        bool   match     = (len == n) && (memcmp(str, word, n) == 0);
+
+        if (match) {
+            inBlock = !inBlock;
+            return true;
+        }
+
+        return inBlock;
+    }
+
+    // Returns false if the line is a statement with errors
+    bool parse(const char* str, size_t len, bool cut, statement_t& s) {
+        trim(str, len);
+
+        if (len == 0) return true;
+
+        const char* args = str;
+        size_t args_len  = len;
+
+        if (keyword(args, args_len, "VAR")) {
+            s.op = FLOW_SET;
+            if (cut) return fail(s.line, "Line too long");
+            if (!assignment(args, args_len, true, s)) return false;
+        } else if (str[0] == '$') {
+            s.op = FLOW_SET;
+            if (cut) return fail(s.line, "Line too long");
+            if (!assignment(args, args_len, false, s)) return false;
+        } else if (keyword(args, args_len, "IF")) {
+            s.op = FLOW_IF;
+            if (cut) return fail(s.line, "Line too long");
+            if (!condition(args, args_len, s)) return false;
+        } else if (keyword(args, args_len, "ELSE")) {
+            if (cut) return fail(s.line, "Line too long");
+
+            if (keyword(args, args_len, "IF")) {
+                s.op = FLOW_ELSE_IF;
+                if (!condition(args, args_len, s)) return false;
+            } else if (args_len == 0) {
+                s.op = FLOW_ELSE;
+            } else {
+                return fail(s.line, "Expected IF or nothing after ELSE");
+            }
+        } else if (keyword(args, args_len, "WHILE")) {
+            s.op = FLOW_WHILE;
+            if (cut) return fail(s.line, "Line too long");
+            if (!condition(args, args_len, s)) return false;
+        } else if (keyword(args, args_len, "END_IF")) {
+            s.op = FLOW_END_IF;
+        } else if (keyword(args, args_len, "END_WHILE")) {
+            s.op = FLOW_END_WHILE;
+        } else if (keyword(args, args_len, "END_FUNCTION")) {
+            s.op = FLOW_END_FUNCTION;
+        } else if (keyword(args, args_len, "RETURN")) {
+            s.op = FLOW_RETURN;
+        } else if (keyword(args, args_len, "FUNCTION")) {
+            size_t n = name(args, args_len);
+
+            if (cut || (n == 0) || (args_len != n + 2) || (memcmp(&args[n], "()", 2) != 0)) return fail(s.line, "Expected FUNCTION name()");
+            if (blocksLen > 0) return fail(s.line, "FUNCTION inside of a block");
+            if (functionsLen == FLOW_FUNCTIONS) return fail(s.line, "Too many functions");
+
+            uint32_t hash = lineindex::hash(HASH_INIT, args, n);
+
+            if (findName(functionNames, functionsLen, hash) >= 0) return fail(s.line, "FUNCTION defined twice");
+
+            functionNames[functionsLen] = hash;
+            functions[functionsLen]     = statementsLen;
+            ++functionsLen;
+
+            s.op = FLOW_FUNCTION;
+        } else {
+            size_t n = name(str, len);
+
+            // Everything else is sent to the ATmega
+            if (cut || (n == 0) || (len != n + 2) || (memcmp(&str[n], "()", 2) != 0)) return true;
+
+            int f = findName(functionNames, functionsLen, lineindex::hash(HASH_INIT, str, n));
+
+            if (f < 0) return fail(s.line, "Unknown function");
+
+            s.op   = FLOW_CALL;
+            s.next = functions[f];
+        }
+
+        return add(s);
+    }
+
+    size_t after(const statement_t& s, uint32_t* offset) {
+        *offset = s.after;
+        return s.line + 1;
+    }
+
+    size_t at(const statement_t& s, uint32_t* offset) {
+        *offset = s.offset;
+        return s.line;
+    }
+
+    int find(size_t line) {
+        size_t lo = 0;
+        size_t hi = statementsLen;
+
+        while (lo < hi) {
+            size_t mid = (lo + hi) / 2;
+
+            if (statements[mid].line < line) lo = mid + 1;
+            else hi = mid;
+        }
+
+        return (lo < statementsLen) && (statements[lo].line == line) ? lo : -1;
+    }
+
+    // Follows IF and ELSE IF until a condition is true
+    size_t branch(uint16_t i, uint32_t* offset) {
+        while (true) {
+            const statement_t& s = statements[i];
+
+            if (((s.op == FLOW_IF) || (s.op == FLOW_ELSE_IF)) && !eval(s.expr)) {
+                i = s.next;
+            } else {
+                return after(s, offset);
+            }
+        }
+    }
+
+    // ===== PUBLIC ===== //
+    bool compile(String fileName) {
+        clear();
+
+        File f = spiffs::open(fileName);
+        if (!f) return false;
+
+        char buf[256];
+        char text[FLOW_LINE_SIZE];
+        size_t text_len = 0;
+        bool   cut      = false;
+        bool   ok       = true;
+        bool   inBlock  = false;
+
+        statement_t s { 0, 0, 0, FLOW_NONE, FLOW_NONE, FLOW_NONE, 0, 0 };
+
+        uint32_t pos = 0;
+
+        while (ok && f.available()) {
+            size_t len = f.read((uint8_t*)buf, sizeof(buf));
+            if (len == 0) break;
+
+            for (size_t j = 0; ok && j < len; ++j) {
+                if (buf[j] == '\n') {
+                    s.after = pos + j + 1;
+                    ok      = blockLine(text, text_len, inBlock) || parse(text, text_len, cut, s);
+
+                    s        = { s.line + 1, s.after, 0, FLOW_NONE, FLOW_NONE, FLOW_NONE, 0, 0 };
+                    text_len = 0;
+                    cut      = false;
+                } else if (text_len < FLOW_LINE_SIZE) {
+                    text[text_len++] = buf[j];
+                } else {
+                    cut = true;
+                }
+            }
+            pos += len;
+        }
+
+        f.close();
+
+        // Last line without a line break
+        if (ok && (text_len > 0)) {
+            s.after = pos;
+            ok      = blockLine(text, text_len, inBlock) || parse(text, text_len, cut, s);
+        }
+
+        if (ok && (blocksLen > 0)) {
+            ok = fail(statements[blocks[blocksLen-1]].line, "Block is never closed");
+        }
+
+        if (!ok) {
+            clear();
+            return false;
+        }
+
+        if (statementsLen > 0) debugf("Compiled %u statements of %s\n", statementsLen, fileName.c_str());
+
+        return true;
+    }
+
+    void clear() {
+        statementsLen = 0;
+        codeLen       = 0;
+        codeOverflow  = false;
+        varsLen       = 0;
+        functionsLen  = 0;
+        blocksLen     = 0;
+        callsLen      = 0;
+    }
+
+    size_t size() {
+        return statementsLen;
+    }
+
+    bool has(size_t line) {
+        return find(line) >= 0;
+    }
+
+    size_t step(size_t line, uint32_t* offset) {
+        int i = find(line);
+
+        if (i < 0) return FLOW_ERROR;
+
+        const statement_t& s = statements[i];
+
+        switch (s.op) {
+            case FLOW_SET:
+                vars[s.var] = eval(s.expr);
+                return after(s, offset);
+
+            case FLOW_IF:
+                return branch(i, offset);
+
+            // The branch before it ran, skip the others
+            case FLOW_ELSE_IF:
+            case FLOW_ELSE:
+                return after(statements[s.end], offset);
+
+            case FLOW_WHILE:
+                if (eval(s.expr)) return after(s, offset);
+                return after(statements[s.end], offset);
+
+            case FLOW_END_WHILE:
+                return at(statements[s.next], offset);
+
+            // Functions only run when they are called
+            case FLOW_FUNCTION:
+                return after(statements[s.end], offset);
+
+            case FLOW_CALL:
+                if (callsLen == FLOW_DEPTH) {
+                    debugf("Line %u: Too many nested calls\n", line + 1);
+                    return FLOW_ERROR;
+                }
+                calls[callsLen++] = i;
+                return after(statements[s.next], offset);
+
+            case FLOW_END_FUNCTION:
+            case FLOW_RETURN:
+                // A script that jumped into a function just continues
+                if (callsLen == 0) return after(s, offset);
+                return after(statements[calls[--callsLen]], offset);
+
+            default:
+                return after(s, offset);
+        }
+    }
+}
@@ -0,0 +1,31 @@
+/*
+   This software is licensed under the MIT License. See the license file for details.
+   Source: https://github.com/spacehuhntech/WiFiDuck
+ */
+
+#pragma once
+
+#include <Arduino.h> // String
+
+// Returned by step() when a statement can't be run
+#define FLOW_ERROR ((size_t)-1)
+
+// Control flow of a script: VAR, IF/ELSE IF/ELSE/END_IF, WHILE/END_WHILE,
+// FUNCTION/END_FUNCTION, RETURN and calls like name().
+// The statements are compiled once into a list with jump targets,
+// every other line is still read from the script.
+namespace duckflow {
+    // Scans a script and builds the statement list, returns false on syntax errors
+    bool compile(String fileName);
+    void clear();
+
+    // Number of statements
+    size_t size();
+
+    // Whether a line (counting from 0) is a statement
+    bool has(size_t line);
+
+    // Runs the statement of a line and returns the line that comes next,
+    // offset is set to the byte offset of that line
+    size_t step(size_t line, uint32_t* offset);
+};
@@ -9,6 +9,12 @@
 #include "debug.h"
 
 #include "com.h"
+#include "duckcompiler.h"
+#include "duckflow.h"
+#include "ducktiming.h"
+#include "jobs.h"
+#include "lineindex.h"
+#include "scriptcache.h"
 #include "spiffs.h"
 
 #include <limits.h>  // For INT_MAX
@@ -17,52 +23,430 @@ namespace duckscript {
     // ===== PRIVATE ===== //
     File f;
 
-    char * prevMessage    { NULL };
-    size_t prevMessageLen { 0 };
-
-    // Line history for multi-line REPEAT
-    #define MAX_HISTORY_LINES 256
-    struct LineHistory {
-        char* line;
-        size_t len;
-    };
-    LineHistory lineHistory[MAX_HISTORY_LINES];
-    int historyCount = 0;
-    int historyIndex = 0;
-
-    // State for ESP-side multi-line REPEAT
-    bool inEspRepeat = false;
-    int espRepeatTimes = 0;
-    int espRepeatLines = 0;
-    int espRepeatCurrentTime = 0;
-    int espRepeatCurrentLine = 0;
+    // Script is read in blocks, the next one is prefetched while the ATmega types
+    #define READ_BLOCK_SIZE 1024
+    char   block[READ_BLOCK_SIZE];
+    size_t blockLen { 0 }; // Bytes in block
+    size_t blockPos { 0 }; // Next byte to be read
+    uint32_t blockStart { 0 }; // File offset of the first byte in block
+
+    // Script hash over everything read so far, checked against the index at the end
+    uint32_t readHash { HASH_INIT };
+    uint32_t readLen { 0 };
+    bool     hashing { false }; // Only while the script is read front to back
+
+    // Number of lines read so far
+    size_t lineNumber { 0 };
+
+    // Whether the next chunk read from the file starts a new line
+    bool lineStart { true };
+
+    // Line the ATmega is working on
+    size_t sentLine { 0 };
+
+    void blockReset() {
+        blockLen   = 0;
+        blockPos   = 0;
+        blockStart = f ? f.position() : 0;
+    }
+
+    // Tops up the block from the file. Lines that were read stay in front until
+    // the room is needed, so jumping back into a short loop finds them in RAM.
+    void blockFill() {
+        if ((blockPos > 0) && (READ_BLOCK_SIZE - blockPos < BUFFER_SIZE)) {
+            memmove(block, &block[blockPos], blockLen - blockPos);
+            blockStart += blockPos;
+            blockLen   -= blockPos;
+            blockPos    = 0;
+        }
+
+        if (f && (blockLen < READ_BLOCK_SIZE) && f.available()) {
+            size_t len = f.read((uint8_t*)&block[blockLen], READ_BLOCK_SIZE - blockLen);
+
+            if (hashing) {
+                readHash = lineindex::hash(readHash, &block[blockLen], len);
+                readLen += len;
+            }
+            blockLen += len;
+        }
+    }
+
+    bool blockAvailable() {
+        return blockPos < blockLen || (f && f.available());
+    }
+
+    // Copies the next line, or as much of it as fits without splitting a UTF-8 character
+    size_t readLine(char* buf, size_t len, bool* eol) {
+        if (blockLen - blockPos <= len) blockFill();
+
+        size_t n = _min(blockLen - blockPos, len);
+
+        const char* line = &block[blockPos];
+        const char* end  = (const char*)memchr(line, '\n', n);
+
+        *eol = end != NULL;
+
+        if (*eol) {
+            n = end - line + 1;
+        } else if ((n == len) && (blockPos + n < blockLen)) {
+            // Don't cut in front of a continuation byte (10xxxxxx)
+            size_t cut = n;
+            while (cut > 0 && (line[cut] & 0xC0) == 0x80) --cut;
+            if (cut > 0) n = cut;
+        } else if ((n == len) && f && f.available()) {
+            // The block ends here, hold back a character that isn't complete yet
+            size_t lead = n;
+            while (lead > 0 && (line[lead - 1] & 0xC0) == 0x80) --lead;
+
+            if (lead > 0) {
+                uint8_t c     = line[lead - 1];
+                size_t  chars = c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : c >= 0xC0 ? 2 : 1;
+
+                if ((lead > 1) && (lead - 1 + chars > n)) n = lead - 1;
+            }
+        }
+
+        memcpy(buf, line, n);
+        blockPos += n;
+
+        if (*eol) ++lineNumber;
+
+        return n;
+    }
+
+    // Whether the next line only holds word
+    bool nextLineIs(const char* word) {
+        size_t n = strlen(word);
+
+        if (blockLen - blockPos < n + 2) blockFill();
+
+        if ((blockLen - blockPos < n) || (memcmp(&block[blockPos], word, n) != 0)) return false;
+
+        return (blockLen - blockPos == n) || (block[blockPos + n] == '\n') || (block[blockPos + n] == '\r');
+    }
+
+    // Puts back what readLine() returned last
+    void unreadLine(size_t n, bool eol, bool start) {
+        blockPos -= n;
+        if (eol) --lineNumber;
+        lineStart = start;
+    }
+
+    // Recent lines are kept back to back in a preallocated ring,
+    // each one prefixed by its length. The oldest lines are dropped to make room.
+    #define HISTORY_WRAP 0xFFFF // Length that marks the rest of the arena as unused
+    char   history[HISTORY_SIZE];
+    size_t historyHead { 0 };     // Oldest line
+    size_t historyTail { 0 };     // Where the next line is written
+    size_t historyCount { 0 };    // Number of lines
+    bool   historyWrapped { false };
+
+    // Lines added since the last one that isn't kept (flow, STRING_BLOCK, TYPEFILE),
+    // a REPEAT without an index can't reach further back than that
+    size_t historyRepeatable { 0 };
+
+    // View of the last line, used by the single-arg REPEAT
+    const char* prevMessage    { NULL };
+    size_t      prevMessageLen { 0 };
+
+    uint16_t historyLen(size_t pos) {
+        uint16_t len;
+        memcpy(&len, &history[pos], sizeof(len));
+        return len;
+    }
+
+    // Returns the position of the line after pos
+    size_t historyNext(size_t pos) {
+        pos += sizeof(uint16_t) + historyLen(pos);
+        if ((pos + sizeof(uint16_t) > HISTORY_SIZE) || (historyLen(pos) == HISTORY_WRAP)) pos = 0;
+        return pos;
+    }
+
+    void historyClear() {
+        historyHead       = 0;
+        historyTail       = 0;
+        historyCount      = 0;
+        historyWrapped    = false;
+        historyRepeatable = 0;
+        prevMessage       = NULL;
+        prevMessageLen    = 0;
+    }
+
+    void historyDrop() {
+        if (historyCount == 0) return;
+
+        size_t next = historyNext(historyHead);
+
+        if (--historyCount == 0) {
+            historyClear();
+            return;
+        }
+
+        if (next < historyHead) historyWrapped = false;
+        historyHead = next;
+    }
+
+    void historyAdd(const char* buf, size_t len) {
+        size_t need = sizeof(uint16_t) + len;
+
+        if (need > HISTORY_SIZE) {
+            historyClear();
+            return;
+        }
+
+        if (historyCount == 0) historyClear();
+
+        // Free space is [tail, end) and [0, head), or [tail, head) once wrapped
+        while (true) {
+            if (!historyWrapped) {
+                if (historyTail + need <= HISTORY_SIZE) break;
+
+                if (historyTail + sizeof(uint16_t) <= HISTORY_SIZE) {
+                    uint16_t wrap = HISTORY_WRAP;
+                    memcpy(&history[historyTail], &wrap, sizeof(wrap));
+                }
+                historyTail    = 0;
+                historyWrapped = true;
+            } else if (historyTail + need <= historyHead) {
+                break;
+            } else {
+                historyDrop();
+                if (historyCount == 0) break;
+            }
+        }
+
+        uint16_t len16 = len;
+        memcpy(&history[historyTail], &len16, sizeof(len16));
+        memcpy(&history[historyTail + sizeof(len16)], buf, len);
+
+        prevMessage    = &history[historyTail + sizeof(len16)];
+        prevMessageLen = len;
+
+        historyTail += need;
+        ++historyCount;
+        ++historyRepeatable;
+    }
+
+    // Position of the n-th line from the oldest one
+    size_t historyAt(size_t n) {
+        size_t pos = historyHead;
+        while (n-- > 0) pos = historyNext(pos);
+        return pos;
+    }
+
+    // State for ESP-side multi-line REPEAT,
+    // the lines from espRepeatStart up to the REPEAT line are read again from the file.
+    // Scripts without an index repeat from the history instead.
+    bool   inEspRepeat          = false;
+    bool   espRepeatFromRam     = false;
+    int    espRepeatTimes       = 0;
+    int    espRepeatCurrentTime = 0;
+    size_t espRepeatStart       = 0; // First repeated line, or its history position
+    size_t espRepeatEnd         = 0; // The REPEAT line, or the number of repeated lines
+    size_t espRepeatCurrentLine = 0; // Lines sent from history in this repetition
+    size_t espRepeatPos         = 0; // History position of the next line
 
     bool running { false };
+    bool paused { false };
+
+    // Nothing is sent until the ATmega finished an abort
+    bool waitForAbort { false };
+
+    // Status that arrived while paused and is handled on resume
+    bool pendingNext { false };
+    bool pendingRepeat { false };
+
+    // Where a stopped script continues, with the delay and repetitions
+    // the ATmega still had left when it was stopped
+    typedef struct resume_point_t {
+        String       script;
+        size_t       line;
+        unsigned int wait;
+        unsigned int repeats;
+    } resume_point_t;
+
+    resume_point_t resumePoint;
+
+    // Timing state that is restored before the next line is sent
+    unsigned int restoreWait { 0 };
+    unsigned int restoreRepeats { 0 };
+
+    // The rest of a comment that didn't fit into one chunk
+    bool inComment { false };
+
+    // The last line that wasn't a REPEAT, a single-arg REPEAT depends on it
+    duckcompiler::line_type prevType { duckcompiler::LINE_EMPTY };
+    uint32_t prevDelay { 0 };
+
+    // Settings don't need a frame of their own, they go in front of the next one
+    #define SETTINGS_SIZE 32
+    uint8_t settings[SETTINGS_SIZE];
+    size_t  settingsLen { 0 };
+    size_t  settingsLine { 0 }; // First line with a pending setting
+
+    // The next frame, staged while the ATmega or a DELAY is busy
+    char   staged[BUFFER_SIZE];
+    size_t stagedLen { 0 };
+    bool   stagedCode { false };
+    bool   stagedTyping { false }; // Ends with STRING/STRINGLN
+    bool   stagedRepeat { false }; // Single-arg REPEAT, the ATmega asks for the line again
+    bool   sentRepeat { false };
+    size_t stagedLine { 0 };
+    bool   eof { false };
+
+    // Statements that run before the ESP takes a break, so WHILE (TRUE) can't block it
+    #define FLOW_STEPS 64
+    bool flowBusy { false }; // Nothing was staged yet, update() continues
+
+    // STRING_BLOCK and TYPEFILE are streamed, the ATmega gets the next frame while it types
+    bool       streamPending { false }; // Starts when nextLine() is called
+    bool       streamRunning { false }; // Until the source ran dry
+    size_t     streamLine { 0 };
+    com_source streamSource { NULL };
+    File       typeFile;
 
-    // Helper function to add line to history
-    void addToHistory(const char* buf, size_t len) {
-        // Free the oldest line if we're at capacity
-        if (lineHistory[historyIndex].line) {
-            free(lineHistory[historyIndex].line);
-            lineHistory[historyIndex].line = NULL;
+    void streamReset() {
+        streamPending = false;
+        streamRunning = false;
+        if (typeFile) typeFile.close();
+    }
+
+    // Frames come from the recorded run of the script, nothing is read from it
+    bool cached { false };
+
+    // Frames and DELAYs go to the timing model instead of the ATmega
+    bool dry { false };
+
+    // A dry run stops after this many frames, in case a loop never ends
+    #define DRYRUN_STEPS 10000
+
+    // Frames of a dry run per update(), WiFi and the web server need to run in between
+    #define DRYRUN_STEPS_PER_UPDATE 32
+
+    // The dry run that was asked for, it starts and runs in update()
+    String          dryScript;
+    dryrun_callback dryCallback { NULL };
+    size_t          drySteps { 0 };
+    resume_point_t  dryPoint;
+
+    // DELAYs run on the ESP
+    bool          delaying { false };
+    unsigned long delayEnd { 0 };
+    unsigned long delayLeft { 0 }; // Remaining time while paused
+
+    void startDelay(unsigned long ms) {
+        if (dry) {
+            ducktiming::delay(ms, sentLine);
+            return;
         }
-        
-        // Store the new line
-        lineHistory[historyIndex].line = (char*)malloc(len + 1);
-        if (lineHistory[historyIndex].line) {
-            memcpy(lineHistory[historyIndex].line, buf, len);
-            lineHistory[historyIndex].line[len] = '\0';
-            lineHistory[historyIndex].len = len;
-            
-            // Move to next slot in circular buffer
-            historyIndex = (historyIndex + 1) % MAX_HISTORY_LINES;
-            if (historyCount < MAX_HISTORY_LINES) historyCount++;
+
+        if (delaying) {
+            delayEnd += ms;
         } else {
-            // Malloc failed - log and continue without storing
-            debugln("Warning: Failed to allocate memory for line history");
+            delaying = true;
+            delayEnd = millis() + ms;
+        }
+    }
+
+    unsigned long delayRemaining() {
+        if (!delaying) return 0;
+        if (paused) return delayLeft;
+
+        long left = delayEnd - millis();
+        return left > 0 ? left : 0;
+    }
+
+    // A DELAY of the script, unlike the ones that are restored
+    void scriptDelay(size_t line, unsigned long ms) {
+        uint32_t ms32 = ms;
+
+        sentLine = line;
+        startDelay(ms);
+        scriptcache::add(CACHE_DELAY, 0, line, &ms32, sizeof(ms32));
+    }
+
+    void stageSettings() {
+        memcpy(staged, settings, settingsLen);
+        stagedLen    = settingsLen;
+        stagedCode   = true;
+        stagedLine   = settingsLine;
+        stagedRepeat = false;
+        settingsLen  = 0;
+    }
+
+    // Returns false if the line can't be compiled
+    bool addSetting(const char* buf, size_t len, size_t line) {
+        uint8_t code[SETTINGS_SIZE];
+        size_t  code_len = duckcompiler::compile(buf, len, code, sizeof(code));
+
+        if (code_len == 0) return false;
+
+        if (settingsLen + code_len > SETTINGS_SIZE) stageSettings();
+        if (settingsLen == 0) settingsLine = line;
+
+        memcpy(&settings[settingsLen], code, code_len);
+        settingsLen += code_len;
+
+        return true;
+    }
+
+    // Complete lines are compiled to bytecode, everything else is sent as text.
+    // Returns false if the pending settings had to be staged on their own instead.
+    bool stageLine(const char* buf, size_t len, bool complete, size_t line) {
+        uint8_t code[BUFFER_SIZE];
+        size_t  code_len = complete ? duckcompiler::compile(buf, len, code, sizeof(code)) : 0;
+
+        stagedTyping = duckcompiler::typing(code, code_len);
+
+        if (settingsLen > 0) {
+            if ((code_len == 0) || (settingsLen + code_len > BUFFER_SIZE)) {
+                stageSettings();
+                return false;
+            }
+
+            memmove(&code[settingsLen], code, code_len);
+            memcpy(code, settings, settingsLen);
+            code_len   += settingsLen;
+            settingsLen = 0;
+        } else if (code_len > len) {
+            // Single keys are shorter as text
+            code_len = 0;
         }
+
+        if (code_len > 0) memcpy(staged, code, code_len);
+        else memcpy(staged, buf, len);
+
+        stagedLen  = code_len > 0 ? code_len : len;
+        stagedCode = code_len > 0;
+        stagedLine = line;
+
+        stagedTyping = stagedTyping && stagedCode;
+
+        return true;
+    }
+
+#ifdef ENABLE_COALESCING
+    // Adds a STRING/STRINGLN line to the staged frame, if it fits.
+    // Every instruction still gets its default delay on the ATmega.
+    bool appendLine(const char* buf, size_t len) {
+        uint8_t code[BUFFER_SIZE];
+        size_t  code_len = duckcompiler::compile(buf, len, code, sizeof(code));
+
+        if (!duckcompiler::typing(code, code_len) || (stagedLen + code_len > BUFFER_SIZE)) return false;
+
+        memcpy(&staged[stagedLen], code, code_len);
+        stagedLen += code_len;
+
+        return true;
+    }
+
+#else // ifdef ENABLE_COALESCING
+    bool appendLine(const char* buf, size_t len) {
+        return false;
     }
 
+#endif // ifdef ENABLE_COALESCING
+
     // Helper function to parse REPEAT command arguments
     // Returns: 0 = not a REPEAT, 1 = single-arg REPEAT, 2 = two-arg REPEAT
     // Sets times and lines output parameters
@@ -113,8 +497,8 @@ namespace duckscript {
             int digit = buf[i] - '0';
             // Correct overflow check
             if (*lines > INT_MAX_DIV_10 || (*lines == INT_MAX_DIV_10 && digit > INT_MAX_MOD_10)) {
-                // Overflow would occur, cap at MAX_HISTORY_LINES
-                *lines = MAX_HISTORY_LINES;
+                // Overflow would occur, more lines than any script has
+                *lines = INT_MAX;
                 // Skip remaining digits
                 while (i < len && buf[i] >= '0' && buf[i] <= '9') i++;
                 break;
@@ -127,156 +511,435 @@ namespace duckscript {
         return 2;
     }
 
-    // Helper function to send next line in ESP-side repeat sequence
-    void sendNextEspRepeatLine() {
-        if (!inEspRepeat) return;
-        
-        // Check if we've completed all repetitions
-        if (espRepeatCurrentTime >= espRepeatTimes) {
-            inEspRepeat = false;
-            espRepeatTimes = 0;
-            espRepeatLines = 0;
-            espRepeatCurrentTime = 0;
-            espRepeatCurrentLine = 0;
-            debugln("ESP-side REPEAT completed");
-            nextLine();  // Continue with next line from file
-            return;
+    // Frames go to the ATmega, or to its timing model during a dry run
+    void send(bool code, const char* buf, size_t len) {
+        if (dry) {
+            unsigned int repeats = ducktiming::frame(code, buf, len, sentLine);
+
+            // The ATmega asks for the last line again, see repeat()
+            while (repeats-- > 0 && prevMessage) ducktiming::frame(false, prevMessage, prevMessageLen, sentLine);
+        } else if (code) {
+            com::sendBytecode((const uint8_t*)buf, len);
+        } else {
+            com::send(buf, len);
         }
-        
-        // Additional safety check - make sure we still have enough history
-        if (espRepeatLines > historyCount) {
-            debugln("ESP-side REPEAT aborted - insufficient history");
-            inEspRepeat = false;
-            espRepeatTimes = 0;
-            espRepeatLines = 0;
-            espRepeatCurrentTime = 0;
+    }
+
+    void resetEspRepeat() {
+        inEspRepeat          = false;
+        espRepeatFromRam     = false;
+        espRepeatTimes       = 0;
+        espRepeatCurrentTime = 0;
+        espRepeatStart       = 0;
+        espRepeatEnd         = 0;
+        espRepeatCurrentLine = 0;
+        espRepeatPos         = 0;
+    }
+
+    // Sends the next line of a REPEAT from history, returns false when done
+    bool sendEspRepeatLine() {
+        if (espRepeatCurrentLine == espRepeatEnd) {
             espRepeatCurrentLine = 0;
-            nextLine();
-            return;
-        }
-        
-        // Send the next line in the current repetition
-        // Calculate the actual index correctly based on history size
-        int actualStart;
-        if (historyCount < MAX_HISTORY_LINES) {
-            // History not yet full, start from beginning
-            actualStart = historyCount - espRepeatLines;
-            // Safety check for negative index
-            if (actualStart < 0) {
-                debugln("ESP-side REPEAT aborted - invalid start index");
-                inEspRepeat = false;
-                espRepeatTimes = 0;
-                espRepeatLines = 0;
-                espRepeatCurrentTime = 0;
-                espRepeatCurrentLine = 0;
-                nextLine();
-                return;
+            espRepeatPos         = espRepeatStart;
+
+            if (++espRepeatCurrentTime >= espRepeatTimes) {
+                debugln("ESP-side REPEAT completed");
+                resetEspRepeat();
+                return false;
             }
-        } else {
-            // History is full, use circular buffer calculation
-            actualStart = (historyIndex - espRepeatLines + MAX_HISTORY_LINES) % MAX_HISTORY_LINES;
         }
-        
-        int idx;
-        if (historyCount < MAX_HISTORY_LINES) {
-            idx = actualStart + espRepeatCurrentLine;
+
+        debugf("ESP REPEAT [%d/%d] line [%u/%u]\n",
+               espRepeatCurrentTime + 1, espRepeatTimes,
+               espRepeatCurrentLine + 1, espRepeatEnd);
+
+        const char* line = &history[espRepeatPos + sizeof(uint16_t)];
+
+        send(false, line, historyLen(espRepeatPos));
+        scriptcache::add(CACHE_TEXT, 0, sentLine, line, historyLen(espRepeatPos));
+
+        espRepeatPos = historyNext(espRepeatPos);
+        ++espRepeatCurrentLine;
+
+        return true;
+    }
+
+    // Moves to a line that starts at offset, the next read refills the block unless it's still in there
+    bool jump(size_t line, uint32_t offset) {
+        if (!f) return false;
+
+        if ((offset >= blockStart) && (offset < blockStart + blockLen)) {
+            blockPos = offset - blockStart;
         } else {
-            idx = (actualStart + espRepeatCurrentLine) % MAX_HISTORY_LINES;
+            f.seek(offset, SeekSet);
+            blockReset();
         }
-        
-        // Validate index and line existence before sending
-        if (idx >= 0 && idx < MAX_HISTORY_LINES && lineHistory[idx].line) {
-            debugf("ESP REPEAT [%d/%d] line [%d/%d]\n", 
-                   espRepeatCurrentTime + 1, espRepeatTimes, 
-                   espRepeatCurrentLine + 1, espRepeatLines);
-            com::send(lineHistory[idx].line, lineHistory[idx].len);
-        } else {
-            // Missing line - abort the repeat
-            debugf("ESP-side REPEAT aborted - missing line at index %d\n", idx);
-            inEspRepeat = false;
-            espRepeatTimes = 0;
-            espRepeatLines = 0;
-            espRepeatCurrentTime = 0;
-            espRepeatCurrentLine = 0;
-            nextLine();
-            return;
+
+        lineNumber = line;
+        lineStart  = true;
+        hashing    = false;
+
+        return true;
+    }
+
+    // Moves to a line using the index
+    bool jump(size_t line) {
+        if (!lineindex::isOpen() || (line > lineindex::lines())) return false;
+
+        return jump(line, lineindex::offset(line));
+    }
+
+    bool position(size_t line) {
+        if (!jump(line)) return false;
+
+        sentLine  = line;
+        stagedLen = 0;
+        eof       = false;
+        delaying  = false;
+        inComment = false;
+        flowBusy  = false;
+
+        streamReset();
+        resetEspRepeat();
+
+        return true;
+    }
+
+    // Finds the first of the last n lines before line that REPEAT <times> <lines> repeats.
+    // Like in the history, empty lines, comments and REPEATs don't count,
+    // and it can't reach past lines that aren't kept in it (flow, STRING_BLOCK, TYPEFILE).
+    bool repeatStart(size_t line, size_t n, size_t* start) {
+        if (!lineindex::isOpen() || !f) return false;
+
+        // Enough to tell what the line is, the rest of the file is read where it was
+        uint32_t pos = f.position();
+        char     buf[16];
+
+        while ((n > 0) && (line > 0)) {
+            --line;
+
+            if (duckflow::has(line)) break;
+
+            f.seek(lineindex::offset(line), SeekSet);
+
+            size_t      len = f.read((uint8_t*)buf, sizeof(buf));
+            const char* end = (const char*)memchr(buf, '\n', len);
+
+            if (end) len = end - buf + 1;
+
+            uint32_t value;
+            duckcompiler::line_type type = duckcompiler::classify(buf, len, &value);
+
+            if ((type == duckcompiler::LINE_EMPTY) || (type == duckcompiler::LINE_COMMENT)) continue;
+            if (strncmp(buf, "REPEAT", _min(len, (size_t)6)) == 0) continue;
+
+            // The last line of a STRING_BLOCK comes first going back,
+            // a TYPEFILE line can be longer than what was read of it
+            if ((type == duckcompiler::LINE_BLOCK) ||
+                ((len >= 9) && (strncmp(buf, "TYPEFILE ", 9) == 0)) ||
+                ((len >= 10) && (strncmp(buf, "END_STRING", 10) == 0))) break;
+
+            --n;
         }
-        
-        // Move to next line
-        espRepeatCurrentLine++;
-        
-        // If we've sent all lines in this repetition, move to next repetition
-        if (espRepeatCurrentLine >= espRepeatLines) {
-            espRepeatCurrentLine = 0;
-            espRepeatCurrentTime++;
+
+        f.seek(pos, SeekSet);
+        *start = line;
+
+        return n == 0;
+    }
+
+    // Puts a line into the history without sending it, so a REPEAT has something to repeat
+    void seedHistory(size_t line) {
+        if (!jump(line)) return;
+
+        char   buf[BUFFER_SIZE];
+        bool   eol;
+        size_t len = readLine(buf, BUFFER_SIZE, &eol);
+
+        historyAdd(buf, len);
+        prevType = duckcompiler::LINE_OTHER;
+    }
+
+    // Fills a frame with the text of a STRING_BLOCK, returns 0 after END_STRING
+    size_t streamBlock(char* buf, size_t len) {
+        if (!streamRunning || !f) return 0;
+
+        // Room for the instruction and its length
+        char   text[BUFFER_SIZE];
+        size_t max = _min(len, sizeof(text)) - 3;
+        size_t n   = 0;
+
+        // Stop a few bytes early, so a UTF-8 character is never split
+        while (n + 4 <= max) {
+            if (!blockAvailable()) {
+                debugln("STRING_BLOCK without END_STRING");
+                streamRunning = false;
+                break;
+            }
+
+            if (lineStart && nextLineIs("END_STRING")) {
+                char end[16];
+                bool eol;
+                readLine(end, sizeof(end), &eol);
+
+                streamRunning = false;
+                break;
+            }
+
+            bool   eol;
+            size_t r = readLine(&text[n], max - n, &eol);
+
+            lineStart = eol;
+
+            // Line breaks are typed as one ENTER
+            size_t end = n + r;
+
+            for (size_t i = n; i < end; ++i) {
+                if (text[i] != '\r') text[n++] = text[i];
+            }
         }
+
+        if (n == 0) return 0;
+
+        size_t code_len = duckcompiler::compileText(text, n, (uint8_t*)buf, len);
+
+        scriptcache::add(CACHE_STREAM, 0, streamLine, buf, code_len);
+
+        return code_len;
     }
 
-    // ===== PUBLIC ===== //
-    void run(String fileName) {
-        if (fileName.length() > 0) {
-            debugf("Run file %s\n", fileName.c_str());
-            f       = spiffs::open(fileName);
-            running = true;
-            nextLine();
+    // Fills a frame with the next part of a TYPEFILE, returns 0 at the end of the file
+    size_t streamFile(char* buf, size_t len) {
+        char   text[BUFFER_SIZE];
+        size_t max = _min(len, sizeof(text)) - 3;
+        size_t n   = 0;
+
+        // Files that only hold line breaks here and there
+        while (n == 0) {
+            if (!streamRunning || !typeFile || !typeFile.available()) {
+                streamReset();
+                return 0;
+            }
+
+            size_t end = typeFile.read((uint8_t*)text, max);
+
+            // A UTF-8 character that was cut is read again for the next frame
+            if ((end == max) && typeFile.available()) {
+                size_t start = end - 1;
+                while (start > 0 && start + 4 > end && (text[start] & 0xC0) == 0x80) --start;
+
+                uint8_t lead  = text[start];
+                size_t  chars = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC0 ? 2 : 1;
+
+                if ((start > 0) && (start + chars > end)) {
+                    typeFile.seek(typeFile.position() - (end - start), SeekSet);
+                    end = start;
+                }
+            }
+
+            // Line breaks are typed as one ENTER
+            for (size_t i = 0; i < end; ++i) {
+                if (text[i] != '\r') text[n++] = text[i];
+            }
         }
+
+        return duckcompiler::compileText(text, n, (uint8_t*)buf, len);
     }
 
-    void nextLine() {
-        if (!running) return;
-        
-        // If we're in the middle of an ESP-side repeat, continue that
-        if (inEspRepeat) {
-            sendNextEspRepeatLine();
-            return;
+    // Sends the STRING_BLOCK frames of a recorded run, the first one is staged
+    size_t streamCached(char* buf, size_t len) {
+        if (stagedLen > 0) {
+            size_t n = _min(stagedLen, len);
+
+            memcpy(buf, staged, n);
+            stagedLen = 0;
+
+            return n;
         }
 
-        // Loop to handle invalid REPEAT commands without recursion
-        while (running) {
+        scriptcache::record_t r;
+
+        if ((scriptcache::peek() != CACHE_STREAM) || !scriptcache::read(r, buf, len)) {
+            streamRunning = false;
+            return 0;
+        }
+
+        return r.len;
+    }
+
+    // Reads lines until a frame is staged, a DELAY starts or the script ends
+    void stage() {
+        // Typing lines that follow are added to a staged STRING/STRINGLN frame
+        bool appending = false;
+        size_t steps   = 0;
+
+        flowBusy = false;
+
+        // Loop to handle skipped lines, REPEAT commands and jumps without recursion
+        while (running && ((stagedLen == 0) || appending) && !eof && !(inEspRepeat && espRepeatFromRam) &&
+               !streamPending && !streamRunning) {
             if (!f) {
                 debugln("File error");
                 stopAll();
                 return;
             }
 
-            if (!f.available()) {
-                debugln("Reached end of file");
-                stopAll();
+            // Reached the REPEAT line again, go back or continue after it
+            if (inEspRepeat && lineStart && (lineNumber == espRepeatEnd)) {
+                if (appending) return;
+
+                if (++espRepeatCurrentTime < espRepeatTimes) {
+                    debugf("ESP REPEAT [%d/%d]\n", espRepeatCurrentTime + 1, espRepeatTimes);
+                    jump(espRepeatStart);
+                } else {
+                    debugln("ESP-side REPEAT completed");
+                    jump(espRepeatEnd + 1);
+                    resetEspRepeat();
+                }
+                continue;
+            }
+
+            if (!blockAvailable()) {
+                if (appending) return;
+
+                // The script was changed without going through spiffs
+                if (hashing && lineindex::isOpen() && (readLen == lineindex::size()) && (readHash != lineindex::hash())) {
+                    debugln("Index outdated");
+                    lineindex::remove(currentScript());
+                    scriptcache::discard();
+                }
+
+                // Settings at the end still change the ATmega
+                if (settingsLen > 0) stageSettings();
+
+                eof = true;
                 return;
             }
 
             char buf[BUFFER_SIZE];
-            unsigned int buf_i =  0;
-            bool eol           =  false; // End of line
+            bool eol; // End of line
+            bool first = lineStart;
+            size_t line = lineNumber;
+            unsigned int buf_i = readLine(buf, BUFFER_SIZE, &eol);
 
-            while (f.available() && !eol && buf_i < BUFFER_SIZE) {
-                uint8_t b = f.peek();
+            if (!eol) debugln();
 
-                //utf8
-                if((b & 0x80) == 0x80) {
-                    uint8_t extra_chars = 0;
-                
-                    if((b & 0xC0) == 0xC0) {
-                        extra_chars = 2;
-                    } else if((b & 0xE0) == 0xC0) {
-                        extra_chars = 3;
-                    } else if((b & 0xF0) == 0xC0) {
-                        extra_chars = 4;
-                    }
+            bool complete = lineStart && eol;
+            lineStart = eol;
 
-                    // utf8 char doesn't fit into buffer
-                    if ((buf_i + extra_chars) > BUFFER_SIZE) break;
-                }
-                
-                eol        = (b == '\n');
-                buf[buf_i] = f.read();
-                ++buf_i;
-                // debug(char(b));
+            // Comments and empty lines are skipped, the ATmega would ignore them
+            if (inComment) {
+                inComment = !eol;
+                continue;
             }
 
-            if (!eol) debugln();
+            // VAR, IF, WHILE, ... run on the ESP, the lines they lead to are read next
+            if (first && duckflow::has(line)) {
+                if (++steps > FLOW_STEPS) {
+                    unreadLine(buf_i, eol, first);
+                    flowBusy = stagedLen == 0;
+                    return;
+                }
 
-            // Parse REPEAT command
+                uint32_t offset;
+                size_t   next = duckflow::step(line, &offset);
+
+                if (next == FLOW_ERROR) {
+                    stopAll();
+                    return;
+                }
+
+                if (!eol || (next != lineNumber)) jump(next, offset);
+
+                prevType          = duckcompiler::LINE_EMPTY;
+                historyRepeatable = 0;
+                continue;
+            }
+
+            uint32_t value = 0;
+            duckcompiler::line_type type = first ? duckcompiler::classify(buf, buf_i, &value) : duckcompiler::LINE_OTHER;
+
+            if ((type == duckcompiler::LINE_EMPTY) || (type == duckcompiler::LINE_COMMENT)) {
+                inComment = !eol;
+                prevType  = type;
+                continue;
+            }
+
+            if (appending) {
+                if (complete && (type == duckcompiler::LINE_OTHER) && appendLine(buf, buf_i)) {
+                    historyAdd(buf, buf_i);
+                    continue;
+                }
+
+                unreadLine(buf_i, eol, first);
+                return;
+            }
+
+            if (type == duckcompiler::LINE_BLOCK) {
+                // Settings go first, the block is read again for the next frame
+                if (settingsLen > 0) {
+                    stageSettings();
+                    unreadLine(buf_i, eol, first);
+                    return;
+                }
+
+                prevType          = duckcompiler::LINE_EMPTY;
+                historyRepeatable = 0;
+
+                // Nothing to type
+                if (nextLineIs("END_STRING")) {
+                    readLine(buf, BUFFER_SIZE, &eol);
+                    lineStart = eol;
+                    continue;
+                }
+
+                streamPending = true;
+                streamLine    = line;
+                streamSource  = streamBlock;
+                return;
+            }
+
+            if (type == duckcompiler::LINE_FILE) {
+                if (settingsLen > 0) {
+                    stageSettings();
+                    unreadLine(buf_i, eol, first);
+                    return;
+                }
+
+                prevType          = duckcompiler::LINE_EMPTY;
+                historyRepeatable = 0;
+
+                // What is typed depends on another file
+                scriptcache::discard();
+
+                // TYPEFILE /path, the line ends with a line break that makes room for the terminator
+                char*  name     = &buf[8];
+                size_t name_len = buf_i - 8;
+
+                while (name_len > 0 && *name == ' ') {
+                    ++name;
+                    --name_len;
+                }
+                while (name_len > 0 && (name[name_len-1] == '\n' || name[name_len-1] == '\r' || name[name_len-1] == ' ')) --name_len;
+
+                name[name_len] = '\0';
+
+                String path = name;
+                if (!path.startsWith("/")) path = "/" + path;
+
+                if (!spiffs::exists(path) || (spiffs::size(path) == 0)) {
+                    debugf("Nothing to type in %s\n", path.c_str());
+                    continue;
+                }
+
+                typeFile      = spiffs::open(path);
+                streamPending = true;
+                streamLine    = line;
+                streamSource  = streamFile;
+                return;
+            }
+
+            // Parse REPEAT command
             int times = 0, lines = 0;
             int repeatType = parseRepeatCommand(buf, buf_i, &times, &lines);
             
@@ -284,51 +947,502 @@ namespace duckscript {
                 // Two-argument REPEAT: handle on ESP side
                 debugf("ESP-side REPEAT %d lines %d times\n", lines, times);
                 
-                // Validate arguments
-                if (lines > 0 && times > 0 && lines <= historyCount) {
-                    // Start ESP-side repeat sequence
-                    inEspRepeat = true;
-                    espRepeatTimes = times;
-                    espRepeatLines = lines;
+                size_t start;
+
+                // Validate arguments, repeats inside of a repeated block are ignored
+                if (!inEspRepeat && complete && lineindex::isOpen() &&
+                    (lines > 0) && (times > 0) && repeatStart(line, lines, &start)) {
+                    // Start ESP-side repeat sequence by reading the lines again
+                    inEspRepeat          = true;
+                    espRepeatTimes       = times;
                     espRepeatCurrentTime = 0;
+                    espRepeatStart       = start;
+                    espRepeatEnd         = line;
+
+                    jump(espRepeatStart);
+                } else if (!inEspRepeat && complete && !lineindex::isOpen() &&
+                           (lines > 0) && (times > 0) && ((size_t)lines <= _min(historyCount, historyRepeatable))) {
+                    // No index, repeat what is still in the history. It only gets the lines that
+                    // repeatStart() counts, so the same lines are repeated as with an index
+                    inEspRepeat          = true;
+                    espRepeatFromRam     = true;
+                    espRepeatTimes       = times;
+                    espRepeatCurrentTime = 0;
+                    espRepeatStart       = historyAt(historyCount - lines);
+                    espRepeatEnd         = lines;
                     espRepeatCurrentLine = 0;
-                    
-                    // Send the first line
-                    sendNextEspRepeatLine();
-                    return;  // Exit the loop and function
+                    espRepeatPos         = espRepeatStart;
+
+                    // The repeated lines are sent as they are, settings go first
+                    if (settingsLen > 0) stageSettings();
+                    return;
                 } else {
                     // Invalid arguments - skip this command and loop to read next line
-                    debugf("Invalid ESP-side REPEAT: times=%d, lines=%d, historyCount=%d\n", 
-                           times, lines, historyCount);
-                    continue;  // Loop to read next line without sending this one
+                    debugf("Invalid ESP-side REPEAT: times=%d, lines=%d, line=%u\n", 
+                           times, lines, line);
                 }
+                continue;  // Loop to read next line without sending this one
             }
-            
-            // Not a two-arg REPEAT or single-arg REPEAT or other command
-            // Store in history (excluding REPEAT commands)
-            if (strncmp((char*)buf, "REPEAT", _min(buf_i, 6)) != 0) {
-                addToHistory(buf, buf_i);
-                
-                // Also keep prevMessage for backward compatibility with single-arg REPEAT
-                if (prevMessage) free(prevMessage);
-                prevMessageLen = buf_i;
-                prevMessage    = (char*)malloc(prevMessageLen + 1);
-                if (prevMessage) {
-                    memcpy(prevMessage, buf, buf_i);
-                    prevMessage[buf_i] = '\0';
-                } else {
-                    debugln("Warning: Failed to allocate memory for prevMessage");
-                    prevMessageLen = 0;
+
+            bool isRepeat = strncmp((char*)buf, "REPEAT", _min(buf_i, 6)) == 0;
+
+            if (isRepeat) {
+                // Single-arg REPEATs aren't part of a repeated block
+                if (inEspRepeat) continue;
+
+                // Repeating a DELAY is a longer DELAY
+                if (prevType == duckcompiler::LINE_DELAY) {
+                    if (repeatType == 1) scriptDelay(line, prevDelay * times);
+                    continue;
                 }
+
+                // Repeating a comment or a setting changes nothing
+                if (prevType != duckcompiler::LINE_OTHER) continue;
+            } else if (type == duckcompiler::LINE_DELAY) {
+                historyAdd(buf, buf_i);
+                prevType  = type;
+                prevDelay = value;
+                scriptDelay(line, value);
+                continue;
+            } else if ((type == duckcompiler::LINE_SETTING) && addSetting(buf, buf_i, line)) {
+                historyAdd(buf, buf_i);
+                prevType = type;
+                continue;
             }
-            
-            // Send the command to ATmega and exit the loop
-            com::send(buf, buf_i);
+
+            if (!stageLine(buf, buf_i, complete, line)) {
+                // Read again for the next frame
+                unreadLine(buf_i, eol, first);
+                return;
+            }
+
+            stagedRepeat = isRepeat;
+
+            // Keep it for REPEAT, prevMessage points to it
+            if (!isRepeat) {
+                historyAdd(buf, buf_i);
+                prevType = duckcompiler::LINE_OTHER;
+
+#ifdef ENABLE_COALESCING
+                appending = stagedTyping;
+#endif // ifdef ENABLE_COALESCING
+            }
+        }
+    }
+
+
+    // Remembers where the script was, so it can be resumed after it stopped
+    void suspend() {
+        resumePoint.script  = currentScript();
+        resumePoint.line    = sentLine;
+        resumePoint.wait    = _max(com::getDelay(), delayRemaining());
+        resumePoint.repeats = com::getRepeats();
+
+        // Settings that weren't sent yet are read again
+        if ((settingsLen > 0) && (settingsLine < resumePoint.line)) {
+            resumePoint.line    = settingsLine;
+            resumePoint.wait    = 0;
+            resumePoint.repeats = 0;
+        }
+
+        if (f) f.close();
+        running = false;
+        paused  = false;
+        cached  = false;
+
+        // A run that didn't reach the end isn't cached
+        scriptcache::discard();
+        scriptcache::close();
+
+        waitForAbort  = false;
+        pendingNext   = false;
+        pendingRepeat = false;
+
+        restoreWait    = 0;
+        restoreRepeats = 0;
+
+        settingsLen = 0;
+        stagedLen   = 0;
+        eof         = false;
+        delaying    = false;
+        flowBusy    = false;
+
+        streamReset();
+
+        blockReset();
+        lineindex::close();
+        debugln("Stopped script");
+    }
+
+    // Opens a script, a run from the start is sent from the cache or recorded for it
+    bool start(String fileName, bool fromStart = false) {
+        debugf("Run file %s\n", fileName.c_str());
+
+        if (running) suspend();
+
+        f          = spiffs::open(fileName);
+        running    = true;
+        paused     = false;
+        lineStart  = true;
+        lineNumber = 0;
+        sentLine   = 0;
+        readHash   = HASH_INIT;
+        readLen    = 0;
+        hashing    = true;
+
+        restoreWait    = 0;
+        restoreRepeats = 0;
+
+        inComment   = false;
+        prevType    = duckcompiler::LINE_EMPTY;
+        settingsLen = 0;
+        stagedLen   = 0;
+        eof         = false;
+        delaying    = false;
+        flowBusy    = false;
+
+        streamReset();
+
+        resetEspRepeat();
+        blockReset();
+        lineindex::open(fileName);
+
+        if (f && fromStart && lineindex::isOpen()) {
+            cached = scriptcache::open(fileName, lineindex::hash(), lineindex::size());
+            if (!cached) scriptcache::record(fileName, lineindex::hash(), lineindex::size());
+        }
+
+        if (f && !cached && !duckflow::compile(fileName)) {
+            debugln("Script has errors");
+            scriptcache::discard();
+            f.close();
+        }
+
+        return f;
+    }
+
+    void begin() {
+        if (com::aborting()) waitForAbort = true;
+        else nextLine();
+    }
+
+    // Whether only comments and empty lines are left
+    bool atEnd() {
+        if (cached) return scriptcache::peek() == CACHE_END;
+
+        if (!lineStart || inComment || !f || f.available()) return false;
+
+        size_t i = blockPos;
+
+        while (i < blockLen) {
+            const char* line = &block[i];
+            const char* end  = (const char*)memchr(line, '\n', blockLen - i);
+            size_t len       = end ? end - line + 1 : blockLen - i;
+
+            uint32_t value;
+            duckcompiler::line_type type = duckcompiler::classify(line, len, &value);
+
+            if ((type != duckcompiler::LINE_EMPTY) && (type != duckcompiler::LINE_COMMENT)) return false;
+
+            i += len;
+        }
+
+        return true;
+    }
+
+    // Replaces the finished script with the next job and stages its first frame
+    void chain() {
+        String next = jobs::pop();
+
+        scriptcache::commit();
+
+        stopAll();
+        resumePoint.script = String(); // Finished, nothing to resume
+
+        if (!start(next, true)) {
+            stopAll();
+            resumePoint.script = String();
             return;
         }
+
+        if (cached) return;
+
+        stage();
+
+        // The ATmega might still be typing, a DELAY starts once it's done
+        if (delaying) {
+            restoreWait = delayRemaining();
+            delaying    = false;
+        }
+    }
+
+    // The script ran to its end, the next job follows
+    void finish() {
+        debugln("Reached end of file");
+
+        scriptcache::commit();
+
+        if (jobs::pending() && !dry) {
+            chain();
+            nextLine();
+            return;
+        }
+
+        stopAll();
+        resumePoint.script = String(); // Finished, nothing to resume
+    }
+
+    // Sends what the recorded run sent next
+    void nextCached() {
+        scriptcache::record_t r;
+
+        while (running) {
+            if (!scriptcache::read(r, staged, sizeof(staged))) {
+                finish();
+                return;
+            }
+
+            lineNumber = r.line;
+            sentLine   = r.line;
+            sentRepeat = r.flags & CACHE_FLAG_REPEAT;
+
+            switch (r.kind) {
+                case CACHE_TEXT:
+                    com::send(staged, r.len);
+                    return;
+
+                case CACHE_CODE:
+                    com::sendBytecode((const uint8_t*)staged, r.len);
+                    return;
+
+                case CACHE_STREAM:
+                    stagedLen     = r.len;
+                    streamRunning = true;
+
+                    if (!com::stream(streamCached)) {
+                        debugln("Can't stream");
+                        stopAll();
+                    }
+                    return;
+
+                case CACHE_DELAY: {
+                    uint32_t ms;
+                    memcpy(&ms, staged, sizeof(ms));
+                    startDelay(ms);
+                    return;
+                }
+
+                case CACHE_HISTORY:
+                    historyAdd(staged, r.len);
+                    break;
+            }
+        }
+    }
+
+    void dryEnd(const String& res) {
+        stopAll();
+
+        dry         = false;
+        resumePoint = dryPoint;
+
+        dryrun_callback callback = dryCallback;
+
+        dryCallback = NULL;
+        dryScript   = String();
+
+        callback(res);
+    }
+
+    // Starts the dry run, then goes through a few frames of it each time
+    void dryUpdate() {
+        if (!dry) {
+            // Whatever was stopped before can still be resumed
+            dryPoint = resumePoint;
+            dry      = true;
+            drySteps = 0;
+
+            ducktiming::begin();
+
+            if (!start(dryScript)) dryEnd(String());
+            return;
+        }
+
+        for (size_t i = 0; running && (i < DRYRUN_STEPS_PER_UPDATE) && (drySteps < DRYRUN_STEPS); ++i) {
+            nextLine();
+            ++drySteps;
+        }
+
+        if (running && (drySteps < DRYRUN_STEPS)) return;
+
+        bool complete = !running;
+
+        String res = ducktiming::result();
+
+        if (!complete) res += "\nstopped after " + String(DRYRUN_STEPS) + " steps";
+
+        dryEnd(res);
+    }
+
+    // ===== PUBLIC ===== //
+    void run(String fileName) {
+        if (fileName.length() == 0) return;
+
+        // Runs once the dry run is done
+        if (dryCallback) {
+            jobs::add(fileName);
+            return;
+        }
+
+        if (start(fileName, true)) {
+            begin();
+        } else {
+            stopAll();
+            resumePoint.script = String();
+        }
+    }
+
+    bool dryrun(String fileName, dryrun_callback callback) {
+        if (running || dryCallback || !callback || (fileName.length() == 0)) return false;
+
+        if (!fileName.startsWith("/")) fileName = "/" + fileName;
+        if (!spiffs::exists(fileName)) return false;
+
+        dryScript   = fileName;
+        dryCallback = callback;
+
+        return true;
+    }
+
+    void update() {
+        if (dryCallback) {
+            dryUpdate();
+            return;
+        }
+
+        if (!running) {
+            if (jobs::pending() && !com::aborting()) run(jobs::pop());
+            return;
+        }
+
+        // Prefetch while the ATmega is busy, so the next lines are ready in RAM
+        if (!cached && (blockLen - blockPos < READ_BLOCK_SIZE / 2)) blockFill();
+
+        if (delaying && !paused && !waitForAbort) {
+            // The next frame is ready when the delay is over
+            if ((stagedLen == 0) && !cached) stage();
+
+            if (delaying && (long)(millis() - delayEnd) >= 0) {
+                delaying = false;
+                nextLine();
+            }
+        }
+
+        // Statements ran for a while without sending anything, continue now
+        if (flowBusy && !delaying && !paused && !waitForAbort) nextLine();
+
+        // The next job is ready before the ATmega typed the last frame of this one
+        if (jobs::pending() && !eof && (stagedLen == 0) && (settingsLen == 0) && !delaying &&
+            !paused && !waitForAbort && !inEspRepeat && !streamPending && !streamRunning &&
+            !flowBusy && (restoreWait == 0) && (restoreRepeats == 0) &&
+            !sentRepeat && (com::getRepeats() == 0) && atEnd()) {
+            chain();
+        }
+    }
+
+    void nextLine() {
+        if (!running) return;
+
+        if (paused || waitForAbort) {
+            pendingNext = true;
+            return;
+        }
+
+        // update() continues when the delay is over
+        if (delaying) return;
+
+        // Continue the delay and repetitions the ATmega had left
+        if (restoreWait > 0) {
+            startDelay(restoreWait);
+            restoreWait = 0;
+            return;
+        }
+
+        if (restoreRepeats > 0) {
+            String line = "REPEAT " + String(restoreRepeats) + "\n";
+            restoreRepeats = 0;
+            sentRepeat     = true;
+            com::send(line.c_str(), line.length());
+            return;
+        }
+
+        if (cached) {
+            nextCached();
+            return;
+        }
+
+        while (running) {
+            if (stagedLen > 0) {
+                sentLine   = stagedLine;
+                sentRepeat = stagedRepeat;
+
+                if (stagedRepeat && prevMessage) scriptcache::add(CACHE_HISTORY, 0, stagedLine, prevMessage, prevMessageLen);
+                scriptcache::add(stagedCode ? CACHE_CODE : CACHE_TEXT, stagedRepeat ? CACHE_FLAG_REPEAT : 0, stagedLine, staged, stagedLen);
+
+                send(stagedCode, staged, stagedLen);
+
+                stagedLen = 0;
+                return;
+            }
+
+            if (streamPending) {
+                streamPending = false;
+                streamRunning = true;
+                sentLine      = streamLine;
+                sentRepeat    = false;
+
+                if (dry) {
+                    char   frame[BUFFER_SIZE];
+                    size_t len;
+                    bool   first = true;
+
+                    while ((len = streamSource(frame, sizeof(frame))) > 0) {
+                        ducktiming::frame(true, frame, len, streamLine, !first);
+                        first = false;
+                    }
+
+                    streamRunning = false;
+                    continue;
+                }
+
+                if (!com::stream(streamSource)) {
+                    debugln("Can't stream");
+                    stopAll();
+                }
+                return;
+            }
+
+            if (inEspRepeat && espRepeatFromRam) {
+                if (sendEspRepeatLine()) return;
+                continue;
+            }
+
+            if (eof) {
+                finish();
+                return;
+            }
+
+            stage();
+
+            if (delaying || flowBusy) return;
+        }
     }
 
     void repeat() {
+        if (running && (paused || waitForAbort)) {
+            pendingRepeat = true;
+            return;
+        }
+
         if (!prevMessage) {
             stopAll();
         } else {
@@ -338,40 +1452,156 @@ namespace duckscript {
     }
 
     void stopAll() {
-        if (running) {
-            if (f) f.close();
-            running = false;
-            debugln("Stopped script");
-        }
+        if (running) suspend();
         
         // Reset ESP-side repeat state
-        inEspRepeat = false;
-        espRepeatTimes = 0;
-        espRepeatLines = 0;
-        espRepeatCurrentTime = 0;
-        espRepeatCurrentLine = 0;
-        
-        // Free line history
-        for (int i = 0; i < MAX_HISTORY_LINES; i++) {
-            if (lineHistory[i].line) {
-                free(lineHistory[i].line);
-                lineHistory[i].line = NULL;
-                lineHistory[i].len = 0;
-            }
-        }
-        historyCount = 0;
-        historyIndex = 0;
+        resetEspRepeat();
+        historyClear();
     }
 
     void stop(String fileName) {
-        if (fileName.length() == 0) stopAll();
-        else {
+        if (fileName.length() == 0) {
+            // Also stop whatever the ATmega is still typing and everything that was queued
+            com::abort();
+            jobs::clear();
+            stopAll();
+        } else {
             if (running && f && (fileName == currentScript())) {
-                f.close();
-                running = false;
-                debugln("Stopped script");
+                suspend();
+                com::abort();
+            }
+        }
+    }
+
+    void aborted() {
+        if (!waitForAbort) return;
+
+        waitForAbort = false;
+
+        // The abort also ended the pause on the ATmega
+        if (paused) com::pause();
+
+        nextLine();
+    }
+
+    void pause() {
+        com::pause();
+
+        if (running && !paused && !dry) {
+            delayLeft = delayRemaining();
+            paused    = true;
+        }
+    }
+
+    bool resume() {
+        if (dryCallback) return false;
+
+        if (running) {
+            if (paused && delaying) delayEnd = millis() + delayLeft;
+
+            paused = false;
+            com::resume();
+
+            if (pendingRepeat) {
+                pendingRepeat = false;
+                pendingNext   = false;
+                repeat();
+            } else if (pendingNext) {
+                pendingNext = false;
+                nextLine();
             }
+
+            return true;
         }
+
+        if (resumePoint.script.length() == 0) {
+            com::resume();
+            return false;
+        }
+
+        return resume(resumePoint.line);
+    }
+
+    bool resume(size_t line) {
+        if (dryCallback) return false;
+
+        if (running) {
+            return seek(line) && resume();
+        }
+
+        if (resumePoint.script.length() == 0) return false;
+
+        resume_point_t point = resumePoint;
+
+        // Lines with a delay or repetitions left are continued from there
+        bool restore = (line == point.line) && ((point.wait > 0) || (point.repeats > 0));
+
+        if (restore) ++line;
+
+        if (!start(point.script)) {
+            stopAll();
+            return false;
+        }
+
+        if (restore && (point.repeats > 0) && (point.line > 0)) seedHistory(point.line - 1);
+
+        if (!position(line)) {
+            stopAll();
+            return false;
+        }
+
+        if (restore) {
+            restoreWait    = point.wait;
+            restoreRepeats = point.repeats;
+        }
+
+        debugf("Resume %s at line %u\n", point.script.c_str(), line);
+
+        begin();
+
+        return true;
+    }
+
+    bool seek(size_t line) {
+        if (dryCallback || !running || !lineindex::isOpen() || (line > lineindex::lines())) return false;
+
+        com::abort();
+
+        // Lines are only found in the script itself, and the run is no longer one from the start
+        if (cached) {
+            scriptcache::close();
+            cached = false;
+            duckflow::compile(currentScript());
+        }
+        scriptcache::discard();
+
+        position(line);
+
+        restoreWait    = 0;
+        restoreRepeats = 0;
+
+        pendingNext   = false;
+        pendingRepeat = false;
+
+        debugf("Seek to line %u\n", line);
+
+        begin();
+
+        return true;
+    }
+
+    size_t historyUsed() {
+        if (historyCount == 0) return 0;
+        if (historyWrapped) return HISTORY_SIZE - (historyHead - historyTail);
+        return historyTail - historyHead;
+    }
+
+    bool isPaused() {
+        return running && paused;
+    }
+
+    size_t currentLine() {
+        return sentLine;
     }
 
     bool isRunning() {
@@ -380,6 +1610,20 @@ namespace duckscript {
 
     String currentScript() {
         if (!running) return String();
-        return String(f.name());
+        return String(f.fullName());
+    }
+
+    unsigned int progress() {
+        if (!running) return 0;
+
+        if (lineindex::lines() > 0) {
+            return _min(lineNumber * 100 / lineindex::lines(), 100);
+        }
+
+        // Without an index, estimate by bytes
+        size_t size = f.size();
+        if (size == 0) return 0;
+
+        return (f.position() - (blockLen - blockPos)) * 100 / size;
     }
 }
\ No newline at end of file
@@ -7,15 +7,44 @@
 
 #include <Arduino.h> // String
 
+// Receives the result of a dry run
+typedef void (* dryrun_callback)(const String& res);
+
 namespace duckscript {
     void runTest();
     void run(String fileName);
+    void update();
+
+    // Goes through a script without typing it, a few frames per update().
+    // callback gets the estimated time, keystrokes and slowest lines,
+    // or nothing if the script has errors. Returns false if it can't be run.
+    bool dryrun(String fileName, dryrun_callback callback);
 
     void nextLine();
     void repeat();
     void stopAll();
     void stop(String fileName);
+    void aborted();
+
+    // Holds the script and the ATmega where they are
+    void pause();
+
+    // Continues a paused script, or a stopped one where it was stopped
+    bool resume();
+    bool resume(size_t line);
+
+    // Continues the running script at a line (counting from 0)
+    bool seek(size_t line);
+
+    bool isPaused();
+
+    // Bytes of the line history arena in use
+    size_t historyUsed();
+    size_t currentLine();
 
     bool isRunning();
     String currentScript();
+
+    // Percentage of lines sent so far
+    unsigned int progress();
 };
\ No newline at end of file
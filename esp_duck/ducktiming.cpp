@@ -0,0 +1,366 @@
+/*
+   This software is licensed under the MIT License. See the license file for details.
+   Source: https://github.com/spacehuhntech/WiFiDuck
+ */
+
+#include "ducktiming.h"
+
+#include "config.h"
+#include "debug.h"
+
+#include "com.h"
+#include "duckcompiler.h"
+
+// The host polls the keyboard once per ms, every HID report takes that long
+#define REPORT_US 1000
+
+// Lines that are listed in the result
+#define SLOWEST_LINES 5
+
+namespace ducktiming {
+    // ===== PRIVATE ===== //
+    // Settings of the ATmega, as in atmega_duck/duckparser.cpp
+    unsigned long defaultDelay { 5 };
+    unsigned long stringDelay { 0 };
+    unsigned long stringDelayMin { 0 };
+    unsigned long stringDelayMax { 0 };
+    bool randomDelay { false };
+
+    // A STRING line that is longer than a frame, sent as text
+    bool inString { false };
+    bool inStringLn { false };
+
+    // Totals in us
+    uint64_t timeMin { 0 };
+    uint64_t timeMax { 0 };
+    uint64_t linkTime { 0 };
+
+    unsigned long keystrokes { 0 };
+    unsigned long frames { 0 };
+
+    typedef struct slow_line_t {
+        size_t   line;
+        uint64_t time;
+    } slow_line_t;
+
+    // Slowest first, lines that ran more than once add up while they're in here
+    slow_line_t slowest[SLOWEST_LINES];
+    size_t slowestLen { 0 };
+
+    // Time of the frame that is processed, min and max
+    uint64_t frameMin { 0 };
+    uint64_t frameMax { 0 };
+
+    void wait(uint64_t min, uint64_t max) {
+        frameMin += min;
+        frameMax += max;
+    }
+
+    void reports(unsigned int n) {
+        wait((uint64_t)n * REPORT_US, (uint64_t)n * REPORT_US);
+    }
+
+    // A key that is pressed and released
+    void keystroke() {
+        reports(2);
+        ++keystrokes;
+    }
+
+    void type(const char* str, size_t len) {
+        unsigned long chars = 0;
+
+        for (size_t i = 0; i < len; ++i) {
+            if ((str[i] & 0xC0) != 0x80) ++chars;
+        }
+
+        if (chars == 0) return;
+
+        reports(chars * 2);
+        keystrokes += chars;
+
+        // Delays are only between characters
+        uint64_t gaps = chars - 1;
+
+        if (randomDelay) wait(gaps * stringDelayMin * 1000, gaps * stringDelayMax * 1000);
+        else wait(gaps * stringDelay * 1000, gaps * stringDelay * 1000);
+    }
+
+    void defaultWait() {
+        wait((uint64_t)defaultDelay * 1000, (uint64_t)defaultDelay * 1000);
+    }
+
+    uint32_t readVarint(const uint8_t*& p, const uint8_t* end) {
+        uint32_t val   = 0;
+        uint8_t  shift = 0;
+
+        while (p < end && shift < 32) {
+            uint8_t b = *p++;
+            val |= (uint32_t)(b & 0x7F) << shift;
+            if (!(b & 0x80)) break;
+            shift += 7;
+        }
+
+        return val;
+    }
+
+    // Goes through bytecode like the ATmega does, returns the repetitions of a REPEAT
+    unsigned int execute(const uint8_t* p, size_t len) {
+        const uint8_t* end = p + len;
+        unsigned int repeats = 0;
+
+        while (p < end) {
+            bool ignoreDelay = true;
+            uint8_t op = *p++;
+
+            switch (op) {
+                case OP_STRING:
+                case OP_STRINGLN:
+                case OP_TYPE: {
+                    size_t n = readVarint(p, end);
+                    if (n > (size_t)(end - p)) n = end - p;
+
+                    type((const char*)p, n);
+                    p += n;
+
+                    if (op == OP_STRINGLN) keystroke();
+
+                    ignoreDelay = op == OP_TYPE;
+                    break;
+                }
+
+                case OP_DELAY: {
+                    uint64_t ms = readVarint(p, end);
+                    wait(ms * 1000, ms * 1000);
+                    break;
+                }
+
+                case OP_DEFAULT_DELAY:
+                    defaultDelay = readVarint(p, end);
+                    break;
+
+                case OP_STRING_DELAY:
+                    stringDelay = readVarint(p, end);
+                    randomDelay = false;
+                    break;
+
+                case OP_STRING_DELAY_RANDOM:
+                    stringDelayMin = readVarint(p, end);
+                    stringDelayMax = readVarint(p, end);
+                    randomDelay    = true;
+                    stringDelay    = 0;
+                    break;
+
+                case OP_REPEAT:
+                    repeats = readVarint(p, end);
+                    break;
+
+                case OP_LOCALE:
+                    ++p;
+                    break;
+
+                case OP_LED:
+                    readVarint(p, end);
+                    readVarint(p, end);
+                    readVarint(p, end);
+                    ignoreDelay = false;
+                    break;
+
+                case OP_KEYCODE: {
+                    size_t n = readVarint(p, end);
+                    if (n > (size_t)(end - p)) n = end - p;
+
+                    p += n;
+                    if (n > 0) keystroke();
+
+                    ignoreDelay = false;
+                    break;
+                }
+
+                case OP_KEY:
+                case OP_MODIFIER:
+                    ++p;
+                    reports(1);
+                    break;
+
+                case OP_PRESS: {
+                    size_t n = readVarint(p, end);
+                    if (n > (size_t)(end - p)) n = end - p;
+
+                    p += n;
+                    reports(1);
+                    break;
+                }
+
+                case OP_RELEASE:
+                    reports(1);
+                    ++keystrokes;
+                    ignoreDelay = false;
+                    break;
+
+                default:
+                    p = end;
+            }
+
+            if (!ignoreDelay) defaultWait();
+        }
+
+        return repeats;
+    }
+
+    bool startsWith(const char* buf, size_t len, const char* word) {
+        size_t n = strlen(word);
+        return (len >= n) && (memcmp(buf, word, n) == 0);
+    }
+
+    // Text that the ATmega parses itself. Lines that can't be compiled are
+    // parts of long STRING lines, or a key combination.
+    unsigned int text(const char* buf, size_t len) {
+        uint8_t code[BUFFER_SIZE];
+        size_t  code_len = inString ? 0 : duckcompiler::compile(buf, len, code, sizeof(code));
+
+        if (code_len > 0) return execute(code, code_len);
+
+        if (!inString) {
+            inStringLn = startsWith(buf, len, "STRINGLN ");
+            inString   = inStringLn || startsWith(buf, len, "STRING ");
+
+            if (inString) {
+                size_t skip = inStringLn ? 9 : 7;
+                buf += skip;
+                len -= skip;
+            }
+        }
+
+        bool eol = (len > 0) && (buf[len - 1] == '\n');
+
+        while (len > 0 && (buf[len - 1] == '\n' || buf[len - 1] == '\r')) --len;
+
+        if (inString) type(buf, len);
+        else keystroke();
+
+        if (eol) {
+            if (inString && inStringLn) keystroke();
+            inString = false;
+            defaultWait();
+        }
+
+        return 0;
+    }
+
+    // Adds the time of a line to the slowest ones
+    void rank(size_t line, uint64_t time) {
+        size_t i = 0;
+
+        while (i < slowestLen && slowest[i].line != line) ++i;
+
+        if (i < slowestLen) {
+            time += slowest[i].time;
+        } else if (slowestLen < SLOWEST_LINES) {
+            i = slowestLen++;
+        } else if (time > slowest[SLOWEST_LINES - 1].time) {
+            i = SLOWEST_LINES - 1;
+        } else {
+            return;
+        }
+
+        while (i > 0 && slowest[i - 1].time < time) {
+            slowest[i] = slowest[i - 1];
+            --i;
+        }
+
+        slowest[i] = { line, time };
+    }
+
+    void add(size_t line) {
+        timeMin += frameMin;
+        timeMax += frameMax;
+
+        rank(line, (frameMin + frameMax) / 2);
+
+        frameMin = 0;
+        frameMax = 0;
+    }
+
+    String ms(uint64_t us) {
+        return String((unsigned long)((us + 500) / 1000));
+    }
+
+    // ===== PUBLIC ===== //
+    void begin() {
+        defaultDelay   = 5;
+        stringDelay    = 0;
+        stringDelayMin = 0;
+        stringDelayMax = 0;
+        randomDelay    = false;
+
+        inString   = false;
+        inStringLn = false;
+
+        timeMin  = 0;
+        timeMax  = 0;
+        linkTime = 0;
+
+        keystrokes = 0;
+        frames     = 0;
+        slowestLen = 0;
+
+        frameMin = 0;
+        frameMax = 0;
+    }
+
+    unsigned int frame(bool code, const char* buf, size_t len, size_t line, bool streamed) {
+        ++frames;
+
+        if (!streamed) {
+            uint64_t link = com::transferTime(len);
+
+            linkTime += link;
+            wait(link, link);
+        }
+
+        unsigned int repeats = code ? execute((const uint8_t*)buf, len) : text(buf, len);
+
+        add(line);
+
+        return repeats;
+    }
+
+    void delay(unsigned long ms, size_t line) {
+        wait((uint64_t)ms * 1000, (uint64_t)ms * 1000);
+        add(line);
+    }
+
+    String result() {
+        String res;
+
+        res.reserve(128);
+
+        res += "time ";
+        res += ms(timeMin);
+        if (timeMax != timeMin) {
+            res += '-';
+            res += ms(timeMax);
+        }
+        res += " ms\n";
+
+        res += "keystrokes ";
+        res += String(keystrokes);
+        res += '\n';
+
+        res += "frames ";
+        res += String(frames);
+        res += " (";
+        res += ms(linkTime);
+        res += " ms transmitting)";
+
+        for (size_t i = 0; i < slowestLen; ++i) {
+            res += "\nline ";
+            res += String(slowest[i].line + 1);
+            res += ' ';
+            res += ms(slowest[i].time);
+            res += " ms";
+        }
+
+        return res;
+    }
+}
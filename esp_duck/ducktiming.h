@@ -0,0 +1,25 @@
+/*
+   This software is licensed under the MIT License. See the license file for details.
+   Source: https://github.com/spacehuhntech/WiFiDuck
+ */
+
+#pragma once
+
+#include <Arduino.h> // String
+
+// Timing model of the ATmega, estimates how long frames take to be typed
+// without sending them. STRING_DELAY_RANDOM makes the estimate a range.
+namespace ducktiming {
+    // Starts a new estimate with the ATmega's default settings
+    void begin();
+
+    // A frame sent to the ATmega, returns how often it asks for the last line again (REPEAT).
+    // Streamed frames are transmitted while the frame before them is typed.
+    unsigned int frame(bool code, const char* buf, size_t len, size_t line, bool streamed = false);
+
+    // DELAY on the ESP
+    void delay(unsigned long ms, size_t line);
+
+    // Estimated time, keystrokes, frames and the slowest lines (counting from 1)
+    String result();
+};
@@ -28,6 +28,7 @@ void setup() {
     com::onDone(duckscript::nextLine);
     com::onError(duckscript::stopAll);
     com::onRepeat(duckscript::repeat);
+    com::onAborted(duckscript::aborted);
 
     if (spiffs::freeBytes() > 0) com::send(MSG_STARTED);
 
@@ -47,6 +48,9 @@ void setup() {
 
 void loop() {
     com::update();
+    duckscript::update();
+    // Compressing or benchmarking files waits, a running script might be one of them
+    if (!duckscript::isRunning()) spiffs::update();
     webserver::update();
 
     debug_update();
@@ -0,0 +1,120 @@
+/*
+   This software is licensed under the MIT License. See the license file for details.
+   Source: https://github.com/spacehuhntech/WiFiDuck
+ */
+
+#include "jobs.h"
+
+#include "config.h"
+#include "debug.h"
+
+namespace jobs {
+    // ===== PRIVATE ===== //
+    typedef struct job_t {
+        unsigned int id;
+        int          priority;
+        String       script;
+    } job_t;
+
+    // Sorted by priority, jobs with the same priority in the order they were added
+    job_t queue[JOBS_SIZE];
+    size_t queueLen { 0 };
+
+    unsigned int nextId { 1 };
+
+    int find(unsigned int id) {
+        for (size_t i = 0; i < queueLen; ++i) {
+            if (queue[i].id == id) return i;
+        }
+        return -1;
+    }
+
+    void remove(size_t i) {
+        for (; i + 1 < queueLen; ++i) queue[i] = queue[i + 1];
+        queue[--queueLen].script = String();
+    }
+
+    // Moves a job behind the ones with the same or a higher priority
+    void insert(const job_t& job) {
+        size_t i = queueLen++;
+
+        while (i > 0 && queue[i - 1].priority < job.priority) {
+            queue[i] = queue[i - 1];
+            --i;
+        }
+
+        queue[i] = job;
+    }
+
+    // ===== PUBLIC ===== //
+    unsigned int add(String fileName, int priority) {
+        if ((queueLen == JOBS_SIZE) || (fileName.length() == 0)) return 0;
+
+        if (!fileName.startsWith("/")) fileName = "/" + fileName;
+
+        job_t job { nextId, priority, fileName };
+
+        if (++nextId == 0) nextId = 1;
+
+        insert(job);
+
+        debugf("Queued job %u %s (priority %d)\n", job.id, fileName.c_str(), priority);
+
+        return job.id;
+    }
+
+    bool cancel(unsigned int id) {
+        int i = find(id);
+
+        if (i < 0) return false;
+
+        remove(i);
+
+        return true;
+    }
+
+    bool setPriority(unsigned int id, int priority) {
+        int i = find(id);
+
+        if (i < 0) return false;
+
+        job_t job = queue[i];
+        job.priority = priority;
+
+        remove(i);
+        insert(job);
+
+        return true;
+    }
+
+    void clear() {
+        while (queueLen > 0) remove(0);
+    }
+
+    bool pending() {
+        return queueLen > 0;
+    }
+
+    String pop() {
+        if (queueLen == 0) return String();
+
+        String script = queue[0].script;
+
+        debugf("Starting job %u %s\n", queue[0].id, script.c_str());
+
+        remove(0);
+
+        return script;
+    }
+
+    String toString() {
+        String res;
+
+        for (size_t i = 0; i < queueLen; ++i) {
+            if (i > 0) res += '\n';
+            res += String(queue[i].id) + ' ' + String(queue[i].priority) + ' ' + queue[i].script;
+        }
+
+        return res;
+    }
+}
@@ -0,0 +1,26 @@
+/*
+   This software is licensed under the MIT License. See the license file for details.
+   Source: https://github.com/spacehuhntech/WiFiDuck
+ */
+
+#pragma once
+
+#include <Arduino.h> // String
+
+// Scripts waiting to run after the current one, higher priorities first
+namespace jobs {
+    // Returns the id of the job, 0 if the queue is full
+    unsigned int add(String fileName, int priority = 0);
+
+    bool cancel(unsigned int id);
+    bool setPriority(unsigned int id, int priority);
+    void clear();
+
+    bool pending();
+
+    // Removes the next job from the queue and returns its script
+    String pop();
+
+    // One job per line: id, priority, script
+    String toString();
+};
@@ -0,0 +1,271 @@
+/*
+   This software is licensed under the MIT License. See the license file for details.
+   Source: https://github.com/spacehuhntech/WiFiDuck
+ */
+
+#include "lineindex.h"
+
+#include "config.h"
+#include "debug.h"
+
+#include "spiffs.h"
+#include "ramdisk.h"
+
+// SPIFFS file names have at most 31 characters
+#define INDEX_NAME_MAX 31
+#define INDEX_MAGIC 0x5844494C // "LIDX"
+#define INDEX_VERSION 2
+
+// Bytes at the start and at the end of a script that have to match before its index is used
+#define INDEX_SAMPLE 256
+
+namespace lineindex {
+    // ===== PRIVATE ===== //
+    // Offsets are stored first, followed by this trailer.
+    // Offsets are 2 bytes wide for scripts up to 64KB, 4 bytes otherwise.
+    typedef struct trailer_t {
+        uint32_t magic;
+        uint8_t  version;
+        uint8_t  width;
+        uint16_t reserved;
+        uint32_t size;  // Script size in bytes
+        uint32_t hash;   // FNV-1a of the script
+        uint32_t sample; // FNV-1a of its first and last INDEX_SAMPLE bytes
+        uint32_t lines;  // Number of offsets
+    } trailer_t;
+
+    File      idx;
+    trailer_t trailer;
+    String    script;
+
+    bool readTrailer(File& f, trailer_t& t) {
+        if (f.size() < sizeof(trailer_t)) return false;
+
+        f.seek(f.size() - sizeof(trailer_t), SeekSet);
+        if (f.read((uint8_t*)&t, sizeof(trailer_t)) != sizeof(trailer_t)) return false;
+
+        return t.magic == INDEX_MAGIC &&
+               t.version == INDEX_VERSION &&
+               (t.width == 2 || t.width == 4) &&
+               f.size() - sizeof(trailer_t) == t.lines * t.width;
+    }
+
+    // Cheap enough to check every time, catches edits that kept the size of the script
+    uint32_t sample(File& f) {
+        char     buf[INDEX_SAMPLE];
+        size_t   size = f.size();
+        uint32_t h    = HASH_INIT;
+
+        f.seek(0, SeekSet);
+        h = hash(h, buf, f.read((uint8_t*)buf, _min(size, sizeof(buf))));
+
+        if (size > INDEX_SAMPLE) {
+            size_t tail = _min(size - INDEX_SAMPLE, sizeof(buf));
+
+            f.seek(size - tail, SeekSet);
+            h = hash(h, buf, f.read((uint8_t*)buf, tail));
+        }
+
+        return h;
+    }
+
+    void fixPath(String& path) {
+        if (!path.startsWith("/")) {
+            path = "/" + path;
+        }
+    }
+
+    // Closes the index if it belongs to fileName
+    void release(const String& fileName) {
+        if (idx && (script == fileName)) close();
+    }
+
+    // ===== PUBLIC ===== //
+    bool build(String fileName) {
+        fixPath(fileName);
+
+        if (hidden(fileName)) return false;
+
+        String idxName = path(fileName);
+
+        release(fileName);
+        spiffs::remove(idxName);
+
+        if (idxName.length() > INDEX_NAME_MAX) return false;
+
+        File f = spiffs::open(fileName);
+        if (!f) return false;
+
+        File i = spiffs::open(idxName);
+        if (!i) {
+            f.close();
+            return false;
+        }
+
+        trailer_t t;
+
+        t.magic    = INDEX_MAGIC;
+        t.version  = INDEX_VERSION;
+        t.width    = f.size() > 0xFFFF ? 4 : 2;
+        t.reserved = 0;
+        t.size     = f.size();
+        t.hash     = HASH_INIT;
+        t.lines    = 0;
+
+        char    buf[256];
+        uint8_t out[64];
+        size_t  out_len   = 0;
+        bool    lineStart = true;
+        uint32_t pos      = 0;
+
+        while (f.available()) {
+            size_t len = f.read((uint8_t*)buf, sizeof(buf));
+            if (len == 0) break;
+
+            t.hash = hash(t.hash, buf, len);
+
+            for (size_t j = 0; j < len; ++j) {
+                if (lineStart) {
+                    uint32_t o = pos + j;
+                    memcpy(&out[out_len], &o, t.width); // Little endian
+                    out_len += t.width;
+                    ++t.lines;
+
+                    if (out_len == sizeof(out)) {
+                        i.write(out, out_len);
+                        out_len = 0;
+                    }
+                }
+                lineStart = buf[j] == '\n';
+            }
+            pos += len;
+        }
+
+        if (out_len > 0) i.write(out, out_len);
+
+        t.sample = sample(f);
+        i.write((uint8_t*)&t, sizeof(trailer_t));
+
+        i.close();
+        f.close();
+
+        debugf("Indexed %s (%u lines)\n", fileName.c_str(), t.lines);
+
+        return true;
+    }
+
+    void remove(String fileName) {
+        fixPath(fileName);
+
+        if (hidden(fileName)) return;
+
+        release(fileName);
+        spiffs::remove(path(fileName));
+    }
+
+    void rename(String oldName, String newName) {
+        fixPath(oldName);
+        fixPath(newName);
+
+        if (hidden(oldName) || hidden(newName)) return;
+
+        String oldIdx = path(oldName);
+        String newIdx = path(newName);
+
+        release(oldName);
+        release(newName);
+        spiffs::remove(newIdx);
+
+        if (spiffs::exists(oldIdx)) {
+            if (newIdx.length() > INDEX_NAME_MAX) spiffs::remove(oldIdx);
+            else spiffs::rename(oldIdx, newIdx);
+        }
+    }
+
+    bool open(String fileName) {
+        close();
+        fixPath(fileName);
+
+        if (hidden(fileName)) return false;
+
+        String idxName = path(fileName);
+
+        for (int tries = 0; tries < 2; ++tries) {
+            if (spiffs::exists(idxName) && spiffs::exists(fileName)) {
+                idx = spiffs::open(idxName);
+
+                // A script that was changed without building its index again has an outdated one
+                File f = spiffs::open(fileName);
+
+                bool valid = idx && f && readTrailer(idx, trailer) &&
+                             (trailer.size == f.size()) && (trailer.sample == sample(f));
+
+                f.close();
+
+                if (valid) {
+                    script = fileName;
+                    return true;
+                }
+
+                close();
+            }
+
+            if (!build(fileName)) break;
+        }
+
+        debugf("No index for %s\n", fileName.c_str());
+
+        return false;
+    }
+
+    void close() {
+        if (idx) idx.close();
+        script = String();
+    }
+
+    bool isOpen() {
+        return idx;
+    }
+
+    size_t lines() {
+        return idx ? trailer.lines : 0;
+    }
+
+    uint32_t size() {
+        return idx ? trailer.size : 0;
+    }
+
+    uint32_t hash() {
+        return idx ? trailer.hash : 0;
+    }
+
+    uint32_t offset(size_t line) {
+        if (!idx || (line >= trailer.lines)) return size();
+
+        uint32_t o = 0;
+
+        idx.seek(line * trailer.width, SeekSet);
+        idx.read((uint8_t*)&o, trailer.width);
+
+        return o;
+    }
+
+    uint32_t hash(uint32_t h, const char* buf, size_t len) {
+        for (size_t i = 0; i < len; ++i) {
+            h ^= (uint8_t)buf[i];
+            h *= 16777619UL;
+        }
+        return h;
+    }
+
+    bool hidden(const String& fileName) {
+        return fileName.startsWith("/.") || fileName.startsWith(RAMDISK_PREFIX ".");
+    }
+
+    String path(const String& fileName) {
+        // Scripts in RAM keep their index there too
+        if (ramdisk::contains(fileName)) return String(RAMDISK_PREFIX ".idx/") + fileName.substring(strlen(RAMDISK_PREFIX));
+
+        return String(INDEX_PREFIX) + fileName;
+    }
+}
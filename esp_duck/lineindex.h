@@ -0,0 +1,39 @@
+/*
+   This software is licensed under the MIT License. See the license file for details.
+   Source: https://github.com/spacehuhntech/WiFiDuck
+ */
+
+#pragma once
+
+#include <Arduino.h> // String
+
+// Index files are hidden sidecars, /test.script gets /.idx/test.script
+// and /ram/test.script gets /ram/.idx/test.script
+#define INDEX_PREFIX "/.idx"
+
+namespace lineindex {
+    // (Re)builds the index of a script, returns false if it can't have one
+    bool build(String fileName);
+    void remove(String fileName);
+    void rename(String oldName, String newName);
+
+    // Opens the index of a script, builds it first if it's missing or outdated
+    bool open(String fileName);
+    void close();
+    bool isOpen();
+
+    size_t lines();
+    uint32_t size();
+    uint32_t hash();
+
+    // Byte offset of a line (counting from 0), the script size for lines past the end
+    uint32_t offset(size_t line);
+
+    // FNV-1a, start with HASH_INIT
+    #define HASH_INIT 2166136261UL
+    uint32_t hash(uint32_t h, const char* buf, size_t len);
+
+    // Files in /. and /ram/. are hidden and have no index
+    bool hidden(const String& fileName);
+    String path(const String& fileName);
+};
@@ -0,0 +1,408 @@
+/*
+   This software is licensed under the MIT License. See the license file for details.
+   Source: https://github.com/spacehuhntech/WiFiDuck
+ */
+
+#include "packfile.h"
+
+#include "config.h"
+#include "debug.h"
+
+#include "dictionary.h"
+
+#define PACK_MAGIC 0x4B504344 // "DCPK"
+#define PACK_VERSION 1
+
+// Bytes of a compressed block
+#define PACK_DICT 0x80    // 0x80-0xDF: dictionary entry (index + 0x80)
+#define PACK_MATCH 0xE0   // 0xE0-0xFE: repeat earlier bytes of the block (length - 3 + 0xE0), followed by distance - 1
+#define PACK_LITERAL 0xFF // Followed by a byte >= 0x80, smaller bytes are taken as they are
+
+#define PACK_DICT_MAX (PACK_MATCH - PACK_DICT)
+#define MATCH_DISTANCE_MAX 256
+#define MATCH_LEN_MIN 3
+#define MATCH_LEN_MAX (MATCH_LEN_MIN + PACK_LITERAL - PACK_MATCH - 1)
+
+namespace packfile {
+    // ===== PRIVATE ===== //
+    typedef struct header_t {
+        uint32_t magic;
+        uint8_t  version;
+        uint8_t  reserved[3];
+        uint32_t size; // Bytes of content
+    } header_t;
+
+    // Comes before every block, a block that didn't get smaller is stored as it is (packed == len)
+    typedef struct block_t {
+        uint16_t packed;
+        uint16_t len;
+    } block_t;
+
+    // Index of the dictionary in flash, made when it's first needed
+    uint16_t dictOffset[PACK_DICT_MAX];
+    uint8_t  dictLen[PACK_DICT_MAX];
+    char     dictFirst[PACK_DICT_MAX];
+    size_t   dictSize { 0 };
+
+    void indexDictionary() {
+        if (dictSize > 0) return;
+
+        size_t offset = 0;
+
+        while (dictSize < PACK_DICT_MAX && pgm_read_byte(dictionary + offset)) {
+            size_t len = strlen_P(dictionary + offset);
+
+            dictOffset[dictSize] = offset;
+            dictLen[dictSize]    = len;
+            dictFirst[dictSize]  = pgm_read_byte(dictionary + offset);
+
+            offset += len + 1;
+            ++dictSize;
+        }
+    }
+
+    bool readHeader(File& f, header_t& h) {
+        f.seek(0, SeekSet);
+
+        bool ok = (f.read((uint8_t*)&h, sizeof(header_t)) == sizeof(header_t)) &&
+                  (h.magic == PACK_MAGIC) && (h.version == PACK_VERSION);
+
+        f.seek(0, SeekSet);
+
+        return ok;
+    }
+
+    // Greedy like the compression of transmissions, returns 0 if the block doesn't get smaller
+    size_t encode(const uint8_t* in, size_t len, uint8_t* out) {
+        size_t o = 0;
+        size_t i = 0;
+
+        while (i < len) {
+            size_t left = len - i;
+
+            int    best_saving = 0;
+            int    best_dict   = -1;
+            size_t best_dist   = 0;
+            size_t best_len    = 0;
+
+            for (size_t d = 0; d < dictSize; ++d) {
+                size_t l = dictLen[d];
+
+                if ((dictFirst[d] == (char)in[i]) && (l <= left) && ((int)l - 1 > best_saving) &&
+                    (memcmp_P(&in[i], dictionary + dictOffset[d], l) == 0)) {
+                    best_saving = l - 1;
+                    best_dict   = d;
+                }
+            }
+
+            size_t max_dist = _min(i, (size_t)MATCH_DISTANCE_MAX);
+            size_t max_len  = _min(left, (size_t)MATCH_LEN_MAX);
+
+            for (size_t dist = 1; dist <= max_dist; ++dist) {
+                const uint8_t* p = &in[i - dist];
+                size_t l         = 0;
+
+                while (l < max_len && p[l] == in[i + l]) ++l;
+
+                if ((l >= MATCH_LEN_MIN) && ((int)l - 2 > best_saving)) {
+                    best_saving = l - 2;
+                    best_dict   = -1;
+                    best_dist   = dist;
+                    best_len    = l;
+                }
+            }
+
+            if (o + 2 >= len) return 0;
+
+            if (best_saving <= 0) {
+                if (in[i] >= PACK_DICT) out[o++] = PACK_LITERAL;
+                out[o++] = in[i];
+                ++i;
+            } else if (best_dict >= 0) {
+                out[o++] = PACK_DICT + best_dict;
+                i       += dictLen[best_dict];
+            } else {
+                out[o++] = PACK_MATCH + best_len - MATCH_LEN_MIN;
+                out[o++] = best_dist - 1;
+                i       += best_len;
+            }
+        }
+
+        return o;
+    }
+
+    // Reads the compressed bytes of a block in small chunks
+    class BlockReader {
+        public:
+            BlockReader(File& file, size_t len) : file(file), left(len) {}
+
+            int next() {
+                if (pos == len) {
+                    len = left > 0 ? file.read(chunk, _min(left, sizeof(chunk))) : 0;
+                    pos = 0;
+
+                    if (len == 0) return -1;
+                    left -= len;
+                }
+
+                return chunk[pos++];
+            }
+
+        private:
+            File& file;
+            size_t left;
+            uint8_t chunk[32];
+            size_t pos { 0 };
+            size_t len { 0 };
+    };
+
+    // Returns the length of the content, 0 if the block is broken
+    size_t decode(BlockReader& in, uint8_t* out, size_t size) {
+        size_t o = 0;
+        int    b;
+
+        while ((b = in.next()) >= 0) {
+            if (b < PACK_DICT) {
+                if (o >= size) return 0;
+                out[o++] = b;
+            } else if (b < PACK_MATCH) {
+                size_t d = b - PACK_DICT;
+
+                if ((d >= dictSize) || (o + dictLen[d] > size)) return 0;
+
+                memcpy_P(&out[o], dictionary + dictOffset[d], dictLen[d]);
+                o += dictLen[d];
+            } else if (b < PACK_LITERAL) {
+                int    dist = in.next() + 1;
+                size_t l    = b - PACK_MATCH + MATCH_LEN_MIN;
+
+                if ((dist <= 0) || ((size_t)dist > o) || (o + l > size)) return 0;
+
+                // Byte by byte, the match may overlap what it writes
+                for (size_t j = 0; j < l; ++j, ++o) out[o] = out[o - dist];
+            } else {
+                int c = in.next();
+
+                if ((c < 0) || (o >= size)) return 0;
+                out[o++] = c;
+            }
+        }
+
+        return o;
+    }
+
+    // Keeps one decompressed block and the file offsets of all blocks
+    class PackedFileImpl : public fs::FileImpl {
+        public:
+            PackedFileImpl(File file, uint32_t size) : file(file), content(size) {}
+
+            ~PackedFileImpl() {
+                free(offsets);
+            }
+
+            bool begin() {
+                blocks  = (content + PACK_BLOCK - 1) / PACK_BLOCK;
+                offsets = blocks > 0 ? (uint32_t*)malloc(blocks * sizeof(uint32_t)) : NULL;
+
+                if ((blocks > 0) && !offsets) return false;
+
+                uint32_t offset = sizeof(header_t);
+
+                for (size_t i = 0; i < blocks; ++i) {
+                    block_t b;
+
+                    file.seek(offset, SeekSet);
+                    if ((file.read((uint8_t*)&b, sizeof(block_t)) != sizeof(block_t)) || (b.len > PACK_BLOCK)) return false;
+
+                    offsets[i] = offset;
+                    offset    += sizeof(block_t) + b.packed;
+                }
+
+                return offset <= file.size();
+            }
+
+            size_t write(const uint8_t* buf, size_t size) override {
+                debugln("Compressed files are read-only");
+                return 0;
+            }
+
+            int read(uint8_t* buf, size_t size) override {
+                size_t n = 0;
+
+                while (n < size && pos < content) {
+                    size_t offset = pos % PACK_BLOCK;
+
+                    if (!load(pos / PACK_BLOCK) || (offset >= len)) break;
+
+                    size_t chunk = _min(size - n, len - offset);
+
+                    memcpy(&buf[n], &data[offset], chunk);
+                    n   += chunk;
+                    pos += chunk;
+                }
+
+                return n;
+            }
+
+            void flush() override {}
+
+            bool seek(uint32_t pos, fs::SeekMode mode) override {
+                size_t newPos = pos;
+
+                if (mode == fs::SeekCur) newPos = this->pos + pos;
+                else if (mode == fs::SeekEnd) newPos = content - pos;
+
+                if (newPos > content) return false;
+
+                this->pos = newPos;
+
+                return true;
+            }
+
+            size_t position() const override {
+                return pos;
+            }
+
+            size_t size() const override {
+                return content;
+            }
+
+            bool truncate(uint32_t size) override {
+                return false;
+            }
+
+            void close() override {
+                file.close();
+            }
+
+            const char* name() const override {
+                return file.name();
+            }
+
+            const char* fullName() const override {
+                return file.fullName();
+            }
+
+            bool isFile() const override {
+                return true;
+            }
+
+            bool isDirectory() const override {
+                return false;
+            }
+
+        private:
+            File file;
+            uint32_t content;
+
+            uint32_t* offsets { NULL };
+            size_t    blocks { 0 };
+            size_t    pos { 0 };
+
+            uint8_t data[PACK_BLOCK];
+            size_t  loaded { (size_t)-1 };
+            size_t  len { 0 };
+
+            bool load(size_t block) {
+                if (block == loaded) return true;
+                if (block >= blocks) return false;
+
+                loaded = (size_t)-1;
+
+                block_t b;
+
+                file.seek(offsets[block], SeekSet);
+                if (file.read((uint8_t*)&b, sizeof(block_t)) != sizeof(block_t)) return false;
+
+                if (b.packed == b.len) {
+                    len = file.read(data, b.len);
+                } else {
+                    BlockReader in(file, b.packed);
+                    len = decode(in, data, b.len);
+                }
+
+                if (len != b.len) {
+                    debugln("Compressed block broken");
+                    return false;
+                }
+
+                loaded = block;
+
+                return true;
+            }
+    };
+
+    // ===== PUBLIC ===== //
+    bool packed(File& f) {
+        header_t h;
+
+        return f && readHeader(f, h);
+    }
+
+    size_t size(File& f) {
+        header_t h;
+
+        if (f && readHeader(f, h)) return h.size;
+
+        return f.size();
+    }
+
+    File open(File f) {
+        header_t h;
+
+        if (!f || !readHeader(f, h)) return f;
+
+        indexDictionary();
+
+        std::shared_ptr<PackedFileImpl> impl = std::make_shared<PackedFileImpl>(f, h.size);
+
+        if (!impl->begin()) {
+            debugln("Compressed file broken");
+            return File();
+        }
+
+        return File(impl);
+    }
+
+    bool pack(File& src, File& dst) {
+        uint8_t* in = (uint8_t*)malloc(PACK_BLOCK * 2);
+
+        if (!in) return false;
+
+        uint8_t* out = &in[PACK_BLOCK];
+
+        indexDictionary();
+
+        header_t h { PACK_MAGIC, PACK_VERSION, { 0, 0, 0 }, (uint32_t)src.size() };
+
+        src.seek(0, SeekSet);
+
+        bool   ok         = dst.write((uint8_t*)&h, sizeof(header_t)) == sizeof(header_t);
+        size_t packedSize = sizeof(header_t);
+        size_t read       = 0;
+
+        while (ok && src.available()) {
+            block_t b;
+
+            b.len = src.read(in, PACK_BLOCK);
+            if (b.len == 0) break;
+
+            b.packed = encode(in, b.len, out);
+
+            const uint8_t* data = b.packed > 0 ? out : in;
+
+            if (b.packed == 0) b.packed = b.len;
+
+            ok = (dst.write((uint8_t*)&b, sizeof(block_t)) == sizeof(block_t)) &&
+                 (dst.write(data, b.packed) == b.packed);
+
+            packedSize += sizeof(block_t) + b.packed;
+            read       += b.len;
+        }
+
+        free(in);
+
+        // A full flash or a short read leave an incomplete file
+        return ok && (read == h.size) && (packedSize < h.size);
+    }
+}
@@ -0,0 +1,29 @@
+/*
+   This software is licensed under the MIT License. See the license file for details.
+   Source: https://github.com/spacehuhntech/WiFiDuck
+ */
+
+#pragma once
+
+#include <Arduino.h> // String
+#include <FS.h>      // File
+
+// Content of a compressed file is split into blocks of this many bytes,
+// each compressed on its own, so reading takes one block of RAM
+#define PACK_BLOCK 512
+
+// Compressed files. Blocks use the dictionary of compressed transmissions,
+// and repeat earlier bytes of the same block.
+namespace packfile {
+    // Whether f is compressed, leaves it at its start
+    bool packed(File& f);
+
+    // Bytes of content, decompressed if f is compressed
+    size_t size(File& f);
+
+    // f itself if it isn't compressed, otherwise a read-only File that is decompressed while it's read
+    File open(File f);
+
+    // Writes the content of src compressed to dst, returns false if it didn't get smaller
+    bool pack(File& src, File& dst);
+};
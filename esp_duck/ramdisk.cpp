@@ -0,0 +1,227 @@
+/*
+   This software is licensed under the MIT License. See the license file for details.
+   Source: https://github.com/spacehuhntech/WiFiDuck
+ */
+
+#include "ramdisk.h"
+
+#include "config.h"
+#include "debug.h"
+
+#include "lineindex.h"
+
+// Files grow in steps of this many bytes
+#define RAMDISK_BLOCK 128
+
+namespace ramdisk {
+    // ===== PRIVATE ===== //
+    // Bytes allocated for files, including removed ones that are still open
+    size_t used { 0 };
+
+    typedef struct ram_file_t {
+        String   name;
+        uint8_t* data { NULL };
+        size_t   len { 0 };
+        size_t   capacity { 0 };
+
+        ~ram_file_t() {
+            free(data);
+            used -= capacity;
+        }
+
+        // Makes room for n more bytes, returns how many fit
+        size_t reserve(size_t n) {
+            if (len + n <= capacity) return n;
+
+            size_t grow = (len + n - capacity + RAMDISK_BLOCK - 1) / RAMDISK_BLOCK * RAMDISK_BLOCK;
+
+            if (used + grow > RAMDISK_SIZE) grow = (RAMDISK_SIZE - used) / RAMDISK_BLOCK * RAMDISK_BLOCK;
+
+            uint8_t* bigger = grow > 0 ? (uint8_t*)realloc(data, capacity + grow) : NULL;
+
+            if (bigger) {
+                data      = bigger;
+                capacity += grow;
+                used     += grow;
+            }
+
+            return _min(n, capacity - len);
+        }
+    } ram_file_t;
+
+    typedef std::shared_ptr<ram_file_t> ram_file_ptr;
+
+    // An open File keeps its data after the file is removed, until it's closed
+    ram_file_ptr files[RAMDISK_FILES];
+
+    class RamFileImpl : public fs::FileImpl {
+        public:
+            RamFileImpl(ram_file_ptr file) : file(file) {}
+
+            size_t write(const uint8_t* buf, size_t size) override {
+                if (!file) return 0;
+
+                size_t n = file->reserve(size);
+
+                if (n < size) debugln("RAM disk full");
+                if (n == 0) return 0;
+
+                memcpy(&file->data[file->len], buf, n);
+                file->len += n;
+                pos        = file->len;
+
+                return n;
+            }
+
+            int read(uint8_t* buf, size_t size) override {
+                if (!file || (pos >= file->len)) return 0;
+
+                size_t n = _min(size, file->len - pos);
+
+                memcpy(buf, &file->data[pos], n);
+                pos += n;
+
+                return n;
+            }
+
+            void flush() override {}
+
+            bool seek(uint32_t pos, fs::SeekMode mode) override {
+                if (!file) return false;
+
+                size_t newPos = pos;
+
+                if (mode == fs::SeekCur) newPos = this->pos + pos;
+                else if (mode == fs::SeekEnd) newPos = file->len - pos;
+
+                if (newPos > file->len) return false;
+
+                this->pos = newPos;
+
+                return true;
+            }
+
+            size_t position() const override {
+                return pos;
+            }
+
+            size_t size() const override {
+                return file ? file->len : 0;
+            }
+
+            bool truncate(uint32_t size) override {
+                if (!file || (size > file->len)) return false;
+
+                file->len = size;
+                if (pos > size) pos = size;
+
+                return true;
+            }
+
+            void close() override {
+                file = nullptr;
+            }
+
+            // The RAM disk is flat like SPIFFS, both names are the full path
+            const char* name() const override {
+                return fullName();
+            }
+
+            const char* fullName() const override {
+                return file ? file->name.c_str() : "";
+            }
+
+            bool isFile() const override {
+                return (bool)file;
+            }
+
+            bool isDirectory() const override {
+                return false;
+            }
+
+        private:
+            ram_file_ptr file;
+            size_t pos { 0 };
+    };
+
+    int find(const String& fileName) {
+        for (int i = 0; i < RAMDISK_FILES; ++i) {
+            if (files[i] && (files[i]->name == fileName)) return i;
+        }
+        return -1;
+    }
+
+    // ===== PUBLIC ===== //
+    bool contains(const String& fileName) {
+        return fileName.startsWith(RAMDISK_PREFIX);
+    }
+
+    File open(const String& fileName) {
+        int i = find(fileName);
+
+        if (i < 0) {
+            i = 0;
+            while (i < RAMDISK_FILES && files[i]) ++i;
+
+            if (i == RAMDISK_FILES) {
+                debugln("Too many files in RAM");
+                return File();
+            }
+
+            files[i]       = std::make_shared<ram_file_t>();
+            files[i]->name = fileName;
+        }
+
+        return File(std::make_shared<RamFileImpl>(files[i]));
+    }
+
+    bool exists(const String& fileName) {
+        return find(fileName) >= 0;
+    }
+
+    size_t size(const String& fileName) {
+        int i = find(fileName);
+
+        return i >= 0 ? files[i]->len : 0;
+    }
+
+    void remove(const String& fileName) {
+        int i = find(fileName);
+
+        if (i >= 0) files[i] = nullptr;
+    }
+
+    bool rename(const String& oldName, const String& newName) {
+        int i = find(oldName);
+
+        if ((i < 0) || exists(newName)) return false;
+
+        files[i]->name = newName;
+
+        return true;
+    }
+
+    String listDir(const String& dirName, bool all) {
+        String res;
+
+        for (int i = 0; i < RAMDISK_FILES; ++i) {
+            if (!files[i] || !files[i]->name.startsWith(dirName)) continue;
+            if (!all && lineindex::hidden(files[i]->name)) continue;
+
+            res += files[i]->name;
+            res += ' ';
+            res += files[i]->len;
+            res += '\n';
+        }
+
+        return res;
+    }
+
+    size_t usedBytes() {
+        return used;
+    }
+
+    size_t freeBytes() {
+        return RAMDISK_SIZE - used;
+    }
+}
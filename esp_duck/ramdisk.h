@@ -0,0 +1,32 @@
+/*
+   This software is licensed under the MIT License. See the license file for details.
+   Source: https://github.com/spacehuhntech/WiFiDuck
+ */
+
+#pragma once
+
+#include <Arduino.h> // String
+#include <FS.h>      // File
+
+// Files in /ram/ never touch the flash, they're gone after a restart
+#define RAMDISK_PREFIX "/ram/"
+
+// Files kept in RAM, spiffs hands every path in /ram/ over to them
+namespace ramdisk {
+    bool contains(const String& fileName);
+
+    // Like "a+", a missing file is created, writes go to the end
+    File open(const String& fileName);
+
+    bool exists(const String& fileName);
+    size_t size(const String& fileName);
+
+    void remove(const String& fileName);
+    bool rename(const String& oldName, const String& newName);
+
+    // Files that start with dirName, hidden files in /ram/. only with all
+    String listDir(const String& dirName, bool all);
+
+    size_t usedBytes();
+    size_t freeBytes();
+};
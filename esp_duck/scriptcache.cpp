@@ -0,0 +1,318 @@
+/*
+   This software is licensed under the MIT License. See the license file for details.
+   Source: https://github.com/spacehuhntech/WiFiDuck
+ */
+
+#include "scriptcache.h"
+
+#include "config.h"
+#include "debug.h"
+
+#include "lineindex.h"
+#include "spiffs.h"
+#include "ramdisk.h"
+
+#define CACHE_MAGIC 0x48434344 // "DCCH"
+#define CACHE_VERSION 1
+#define CACHE_TEMP CACHE_PREFIX "/new"
+
+namespace scriptcache {
+    // ===== PRIVATE ===== //
+    // Comes first, followed by the records
+    typedef struct header_t {
+        uint32_t magic;
+        uint8_t  version;
+        uint8_t  reserved[3];
+        uint32_t size;       // Script size in bytes
+        uint32_t hash;       // FNV-1a of the script
+        char     script[32]; // SPIFFS file names have at most 31 characters
+    } header_t;
+
+    File     out;
+    header_t outHeader;
+    size_t   outLen { 0 };
+
+    File   in;
+    String inName;
+
+    String name(uint32_t hash) {
+        char hex[9];
+        sprintf(hex, "%08x", hash);
+        return String(CACHE_PREFIX) + '/' + hex;
+    }
+
+    bool readHeader(File& f, header_t& h) {
+        f.seek(0, SeekSet);
+        if (f.read((uint8_t*)&h, sizeof(header_t)) != sizeof(header_t)) return false;
+
+        h.script[sizeof(h.script) - 1] = '\0';
+
+        return h.magic == CACHE_MAGIC && h.version == CACHE_VERSION;
+    }
+
+    // Entry names, one per line
+    String entries() {
+        String res;
+        String dir = spiffs::listDir(CACHE_PREFIX, true);
+
+        int start = 0;
+
+        while (start < (int)dir.length()) {
+            int end   = dir.indexOf('\n', start);
+            int space = dir.indexOf(' ', start);
+
+            if (end < 0) end = dir.length();
+            if ((space > start) && (space < end)) {
+                String entry = dir.substring(start, space);
+                if (entry != CACHE_TEMP) res += entry + '\n';
+            }
+
+            start = end + 1;
+        }
+
+        return res;
+    }
+
+    String nextEntry(const String& list, int& start) {
+        int end = list.indexOf('\n', start);
+        if (end < 0) return String();
+
+        String entry = list.substring(start, end);
+        start = end + 1;
+
+        return entry;
+    }
+
+    // Whether the entry still belongs to its script and every record is complete
+    bool valid(const String& entry, const header_t& h) {
+        if ((entry != name(h.hash)) || !spiffs::exists(h.script) || (spiffs::size(h.script) != h.size)) return false;
+
+        File f = spiffs::open(h.script);
+        if (!f) return false;
+
+        char     buf[256];
+        uint32_t hash = HASH_INIT;
+
+        while (f.available()) {
+            size_t len = f.read((uint8_t*)buf, sizeof(buf));
+            if (len == 0) break;
+            hash = lineindex::hash(hash, buf, len);
+        }
+        f.close();
+
+        if (hash != h.hash) return false;
+
+        File c = spiffs::open(entry);
+        if (!c) return false;
+
+        uint32_t pos  = sizeof(header_t);
+        uint32_t size = c.size();
+        record_t r;
+
+        while (pos + sizeof(record_t) <= size) {
+            c.seek(pos, SeekSet);
+            c.read((uint8_t*)&r, sizeof(record_t));
+            pos += sizeof(record_t) + r.len;
+        }
+        c.close();
+
+        return pos == size;
+    }
+
+    // ===== PUBLIC ===== //
+#ifdef ENABLE_CACHE
+    bool record(String fileName, uint32_t hash, uint32_t size) {
+        discard();
+
+        // Scripts in RAM are gone after a restart, not worth writing to flash
+        if (lineindex::hidden(fileName) || ramdisk::contains(fileName) || (fileName.length() >= sizeof(header_t::script))) return false;
+
+        // The cache never takes the room scripts need
+        if (spiffs::freeBytes() < CACHE_SIZE * 2) return false;
+
+        spiffs::remove(CACHE_TEMP);
+        out = spiffs::open(CACHE_TEMP);
+        if (!out) return false;
+
+        header_t& h = outHeader;
+
+        memset(&h, 0, sizeof(header_t));
+        h.magic   = CACHE_MAGIC;
+        h.version = CACHE_VERSION;
+        h.size    = size;
+        h.hash    = hash;
+        strcpy(h.script, fileName.c_str());
+
+        out.write((uint8_t*)&h, sizeof(header_t));
+
+        outLen = sizeof(header_t);
+
+        return true;
+    }
+
+#else // ifdef ENABLE_CACHE
+    bool record(String fileName, uint32_t hash, uint32_t size) {
+        return false;
+    }
+
+#endif // ifdef ENABLE_CACHE
+
+    void add(uint8_t kind, uint8_t flags, size_t line, const void* data, size_t len) {
+        if (!out) return;
+
+        if (outLen + sizeof(record_t) + len > CACHE_SIZE) {
+            debugln("Run too long to cache");
+            discard();
+            return;
+        }
+
+        record_t r { kind, flags, (uint16_t)len, (uint32_t)line };
+
+        out.write((uint8_t*)&r, sizeof(record_t));
+        out.write((const uint8_t*)data, len);
+
+        outLen += sizeof(record_t) + len;
+    }
+
+    void commit() {
+        if (!out) return;
+
+        out.close();
+
+        // Runs of an older version of the script are of no use anymore
+        String names = entries();
+        int    start = 0;
+        String entry;
+
+        while ((entry = nextEntry(names, start)).length() > 0) {
+            File     f = spiffs::open(entry);
+            header_t h;
+            bool     old = f && readHeader(f, h) && (strcmp(h.script, outHeader.script) == 0);
+
+            f.close();
+
+            if (old && (entry != inName)) spiffs::remove(entry);
+        }
+
+        String outName = name(outHeader.hash);
+
+        spiffs::remove(outName);
+        spiffs::rename(CACHE_TEMP, outName);
+
+        debugf("Cached %s as %s (%u byte)\n", outHeader.script, outName.c_str(), outLen);
+    }
+
+    void discard() {
+        if (!out) return;
+
+        out.close();
+        spiffs::remove(CACHE_TEMP);
+    }
+
+    bool recording() {
+        return out;
+    }
+
+#ifdef ENABLE_CACHE
+    bool open(String fileName, uint32_t hash, uint32_t size) {
+        close();
+
+        String entry = name(hash);
+
+        if (!spiffs::exists(entry)) return false;
+
+        in = spiffs::open(entry);
+
+        header_t h;
+
+        if (in && readHeader(in, h) && (h.hash == hash) && (h.size == size) && (fileName == h.script)) {
+            inName = entry;
+            debugf("Running %s from %s\n", h.script, entry.c_str());
+            return true;
+        }
+
+        close();
+
+        return false;
+    }
+
+#else // ifdef ENABLE_CACHE
+    bool open(String fileName, uint32_t hash, uint32_t size) {
+        return false;
+    }
+
+#endif // ifdef ENABLE_CACHE
+
+    void close() {
+        if (in) in.close();
+        inName = String();
+    }
+
+    bool isOpen() {
+        return in;
+    }
+
+    uint8_t peek() {
+        if (!in || ((size_t)in.available() < sizeof(record_t))) return CACHE_END;
+
+        return in.peek();
+    }
+
+    bool read(record_t& r, void* buf, size_t size) {
+        if (peek() == CACHE_END) return false;
+
+        in.read((uint8_t*)&r, sizeof(record_t));
+
+        if ((r.len > size) || ((size_t)in.available() < r.len)) {
+            debugln("Cache entry broken");
+            close();
+            return false;
+        }
+
+        in.read((uint8_t*)buf, r.len);
+
+        return true;
+    }
+
+    String list(bool verify) {
+        String res;
+        String names = entries();
+        int    start = 0;
+        String entry;
+
+        while ((entry = nextEntry(names, start)).length() > 0) {
+            File     f = spiffs::open(entry);
+            header_t h;
+            bool     ok = f && readHeader(f, h);
+            size_t   size = f.size();
+
+            f.close();
+
+            if (res.length() > 0) res += '\n';
+
+            res += entry + ' ' + String(size) + ' ' + String(ok ? h.script : "?");
+
+            if (verify) res += (ok && valid(entry, h)) ? " ok" : " stale";
+        }
+
+        return res;
+    }
+
+    unsigned int purge() {
+        String names = entries();
+        int    start = 0;
+        String entry;
+
+        unsigned int n = 0;
+
+        // The run that is being sent stays until it's done
+        while ((entry = nextEntry(names, start)).length() > 0) {
+            if (entry == inName) continue;
+
+            spiffs::remove(entry);
+            ++n;
+        }
+
+        return n;
+    }
+}
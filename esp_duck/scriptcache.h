@@ -0,0 +1,60 @@
+/*
+   This software is licensed under the MIT License. See the license file for details.
+   Source: https://github.com/spacehuhntech/WiFiDuck
+ */
+
+#pragma once
+
+#include <Arduino.h> // String
+
+// Cache files are hidden, named after the hash of the script, e.g. /.cache/1a2b3c4d
+#define CACHE_PREFIX "/.cache"
+
+// What a run of a script sent, in order
+#define CACHE_END 0     // No more records
+#define CACHE_TEXT 1    // Text frame
+#define CACHE_CODE 2    // Bytecode frame
+#define CACHE_STREAM 3  // Bytecode frame of a STRING_BLOCK, streamed with the ones that follow
+#define CACHE_DELAY 4   // DELAY on the ESP, 4 bytes of milliseconds
+#define CACHE_HISTORY 5 // Line a single-arg REPEAT repeats
+
+// Frame of a single-arg REPEAT, the ATmega asks for the last history line again
+#define CACHE_FLAG_REPEAT 0x01
+
+// Recorded runs of scripts. The first complete run records every frame
+// the ESP sends, later runs of the unchanged script send them again
+// without reading, interpreting or compiling the script.
+namespace scriptcache {
+    typedef struct record_t {
+        uint8_t  kind;
+        uint8_t  flags;
+        uint16_t len;  // Bytes of data that follow
+        uint32_t line; // Line the frame came from (counting from 0)
+    } record_t;
+
+    // Starts recording a run of a script, hash and size are those of its index
+    bool record(String fileName, uint32_t hash, uint32_t size);
+    void add(uint8_t kind, uint8_t flags, size_t line, const void* data, size_t len);
+
+    // Stores the recording once the script ran to its end
+    void commit();
+    void discard();
+    bool recording();
+
+    // Opens the recorded run of a script, if there is one for this content
+    bool open(String fileName, uint32_t hash, uint32_t size);
+    void close();
+    bool isOpen();
+
+    // Kind of the next record, CACHE_END when there is none
+    uint8_t peek();
+
+    // Reads the next record and its data, returns false at the end
+    bool read(record_t& r, void* buf, size_t size);
+
+    // One entry per line: name, size, script, and with verify whether it's ok or stale
+    String list(bool verify);
+
+    // Removes every entry, returns how many there were
+    unsigned int purge();
+};
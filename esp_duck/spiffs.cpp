@@ -8,21 +8,608 @@
 #include "config.h"
 #include "debug.h"
 
+#include "lineindex.h"
+#include "ramdisk.h"
+#include "packfile.h"
+
+#ifdef ENABLE_LITTLEFS
+#include <LittleFS.h>
+#endif // ifdef ENABLE_LITTLEFS
+
+// Free heap that is left while files are migrated
+#define MIGRATE_HEAP_RESERVE 8192
+
+// Hidden, so a benchmark that didn't finish doesn't show up in ls
+#define BENCH_DIR "/.bench"
+#define BENCH_FILE_SIZE 1024
+
+// Hidden copy of a file while it's compressed or decompressed
+#define PACK_TEMP "/.pack"
+
+// Files that wait to be compressed, and how long nothing has to be written for that
+#define PACK_QUEUE_SIZE 4
+#define PACK_DELAY 2000
+
 namespace spiffs {
     File streamFile;
+    bool streamWritten { false };
 
     // ===== PRIVATE ===== //
+    // Backend every file goes through, chosen in begin()
+    FS*         filesystem { &SPIFFS };
+    const char* filesystemName { "SPIFFS" };
+    bool        directories { false }; // LittleFS has real directories, SPIFFS a flat namespace
+
     void fixPath(String& path) {
         if (!path.startsWith("/")) {
             path = "/" + path;
         }
     }
 
+    // Name and size of every visible file, so ls doesn't have to open each one
+    typedef struct file_meta_t {
+        String name;
+        size_t size;   // Of the content, decompressed
+        bool   packed; // Compressed
+    } file_meta_t;
+
+    file_meta_t meta[FILES_SIZE];
+    size_t metaLen { 0 };
+    bool   metaValid { false }; // Not when there are more files than fit
+
+    // Usage of the flash, until something is written
+    FSInfo info;
+    bool   infoValid { false };
+
+    FSInfo& fsInfo() {
+        if (!infoValid) {
+            filesystem->info(info);
+            infoValid = true;
+        }
+        return info;
+    }
+
+    int findMeta(const String& fileName) {
+        for (size_t i = 0; i < metaLen; ++i) {
+            if (meta[i].name == fileName) return i;
+        }
+        return -1;
+    }
+
+    void setMeta(const String& fileName, size_t size, bool packed = false) {
+        if (!metaValid || lineindex::hidden(fileName) || ramdisk::contains(fileName)) return;
+
+        int i = findMeta(fileName);
+
+        if (i >= 0) {
+            meta[i].size   = size;
+            meta[i].packed = packed;
+        } else if (metaLen < FILES_SIZE) {
+            meta[metaLen++] = { fileName, size, packed };
+        } else {
+            debugln("Too many files to keep in RAM");
+            metaValid = false;
+        }
+    }
+
+    void removeMeta(const String& fileName) {
+        int i = findMeta(fileName);
+
+        if (i < 0) return;
+
+        meta[i] = meta[--metaLen];
+        meta[metaLen].name = String();
+    }
+
+    // Paths of the entries of dirName, SPIFFS lists every file that starts with
+    // dirName, LittleFS only the names of the entries in it
+    void walk(const String& dirName, bool all, void (*found)(const String& fileName, size_t size)) {
+        Dir dir = filesystem->openDir(dirName);
+
+        while (dir.next()) {
+            String name = dir.fileName();
+
+            if (directories) name = (dirName.endsWith("/") ? dirName : dirName + '/') + name;
+
+            if (!all && lineindex::hidden(name)) continue;
+
+            if (dir.isDirectory()) {
+                walk(name, all, found);
+                continue;
+            }
+
+            found(name, dir.fileSize());
+        }
+    }
+
+    // Compressed files are opened to read the size of their content from their header
+    size_t contentSize(const String& fileName, size_t size, bool& packed) {
+        packed = false;
+
+        if (lineindex::hidden(fileName)) return size;
+
+        File f = filesystem->open(fileName, "r");
+
+        packed = packfile::packed(f);
+        if (packed) size = packfile::size(f);
+
+        f.close();
+
+        return size;
+    }
+
+    // Result of listDir()
+    String listing;
+
+    void addListing(const String& fileName, size_t size) {
+        bool packed;
+
+        listing += fileName;
+        listing += ' ';
+        listing += contentSize(fileName, size, packed);
+        listing += '\n';
+    }
+
+    void addMeta(const String& fileName, size_t size) {
+        bool packed;
+
+        size = contentSize(fileName, size, packed);
+        setMeta(fileName, size, packed);
+    }
+
+    void scan() {
+        metaLen   = 0;
+        metaValid = true;
+        walk("/", false, addMeta);
+        debugf("%u files\n", metaLen);
+    }
+
+    bool packed(const String& fileName) {
+        if (lineindex::hidden(fileName) || ramdisk::contains(fileName)) return false;
+
+        if (metaValid) {
+            int i = findMeta(fileName);
+            return (i >= 0) && meta[i].packed;
+        }
+
+        File f   = filesystem->open(fileName, "r");
+        bool res = packfile::packed(f);
+
+        f.close();
+
+        return res;
+    }
+
+#ifdef ENABLE_FILE_COMPRESSION
+    // Compresses a script on flash, it's kept as it is when that doesn't make it smaller
+    void pack(const String& fileName) {
+        if (lineindex::hidden(fileName) || ramdisk::contains(fileName) || packed(fileName)) return;
+
+        File src = filesystem->open(fileName, "r");
+        File dst = filesystem->open(PACK_TEMP, "w");
+
+        bool   smaller = src && dst && packfile::pack(src, dst);
+        size_t size    = src.size();
+
+        src.close();
+        dst.close();
+
+        if (smaller) {
+            filesystem->remove(fileName);
+            filesystem->rename(PACK_TEMP, fileName);
+            setMeta(fileName, size, true);
+        } else {
+            filesystem->remove(PACK_TEMP);
+        }
+
+        infoValid = false;
+    }
+
+    // Scripts are compressed in the loop, once nothing was written to them for PACK_DELAY ms,
+    // so appending line by line doesn't decompress and compress them every time
+    String        packQueue[PACK_QUEUE_SIZE];
+    unsigned long packWritten { 0 };
+
+    void queuePack(const String& fileName) {
+        if (lineindex::hidden(fileName) || ramdisk::contains(fileName)) return;
+
+        packWritten = millis();
+
+        for (size_t i = 0; i < PACK_QUEUE_SIZE; ++i) {
+            if (packQueue[i] == fileName) return;
+        }
+
+        for (size_t i = 0; i < PACK_QUEUE_SIZE; ++i) {
+            if (packQueue[i].length() == 0) {
+                packQueue[i] = fileName;
+                return;
+            }
+        }
+
+        debugln("Too many files to compress, it's done the next time they're written");
+    }
+
+    void renamePack(const String& oldName, const String& newName) {
+        for (size_t i = 0; i < PACK_QUEUE_SIZE; ++i) {
+            if (packQueue[i] == oldName) packQueue[i] = newName;
+        }
+    }
+
+    void unqueuePack(const String& fileName) {
+        renamePack(fileName, String());
+    }
+
+    void clearPack() {
+        for (size_t i = 0; i < PACK_QUEUE_SIZE; ++i) packQueue[i] = String();
+    }
+
+    // Compresses one file per call
+    void packUpdate() {
+        if (streamFile || (millis() - packWritten < PACK_DELAY)) return;
+
+        for (size_t i = 0; i < PACK_QUEUE_SIZE; ++i) {
+            if (packQueue[i].length() > 0) {
+                if (filesystem->exists(packQueue[i])) pack(packQueue[i]);
+                packQueue[i] = String();
+                return;
+            }
+        }
+    }
+
+#else // ifdef ENABLE_FILE_COMPRESSION
+    void queuePack(const String& fileName) {}
+
+    void renamePack(const String& oldName, const String& newName) {}
+
+    void unqueuePack(const String& fileName) {}
+
+    void clearPack() {}
+
+    void packUpdate() {}
+
+#endif // ifdef ENABLE_FILE_COMPRESSION
+
+    // Stores a compressed file as it is again, so it can be written to
+    void unpack(const String& fileName) {
+        if (!packed(fileName)) return;
+
+        File src = packfile::open(filesystem->open(fileName, "r"));
+        File dst = filesystem->open(PACK_TEMP, "w");
+
+        bool ok = src && dst;
+        char buf[256];
+
+        while (ok && src.available()) {
+            size_t len = src.read((uint8_t*)buf, sizeof(buf));
+            ok = (len > 0) && (dst.write((uint8_t*)buf, len) == len);
+        }
+
+        size_t size = src.size();
+
+        ok = ok && (dst.size() == size);
+
+        src.close();
+        dst.close();
+
+        if (ok) {
+            filesystem->remove(fileName);
+            filesystem->rename(PACK_TEMP, fileName);
+            setMeta(fileName, size, false);
+        } else {
+            debugln("Not enough space to decompress");
+            filesystem->remove(PACK_TEMP);
+        }
+
+        infoValid = false;
+    }
+
+    // In a flat namespace dirName is a prefix, with directories everything below it
+    bool inDir(const String& fileName, const String& dirName) {
+        if (!directories || dirName.endsWith("/")) return fileName.startsWith(dirName);
+        return fileName.startsWith(dirName + '/');
+    }
+
+    // Removes a file, but not its index
+    void erase(const String& fileName) {
+        if (ramdisk::contains(fileName)) {
+            ramdisk::remove(fileName);
+            return;
+        }
+
+        filesystem->remove(fileName);
+        unqueuePack(fileName);
+
+        infoValid = false;
+        removeMeta(fileName);
+    }
+
+    // Between RAM and flash files are copied
+    bool move(const String& oldName, const String& newName) {
+        if (!exists(oldName) || exists(newName)) return false;
+
+        File src = open(oldName);
+        File dst = open(newName);
+        bool ok  = src && dst;
+
+        char buf[256];
+
+        while (ok && src.available()) {
+            size_t len = src.read((uint8_t*)buf, sizeof(buf));
+            ok = (len > 0) && (dst.write((uint8_t*)buf, len) == len);
+        }
+
+        if (dst) setMeta(newName, dst.size());
+
+        src.close();
+        dst.close();
+
+        erase(ok ? oldName : newName);
+
+        if (ok) queuePack(newName);
+
+        return ok;
+    }
+
+    // The benchmark that was asked for, it runs in update()
+    unsigned int       benchFiles { 0 };
+    benchmark_callback benchCallback { NULL };
+
+    String benchFile(unsigned int i, bool packed = false) {
+        return String(BENCH_DIR) + '/' + String(i) + (packed ? ".pack" : ".script");
+    }
+
+    // Lines of a made up script, so compressed files are about as small as real ones
+    const char* const BENCH_LINES[] = {
+        "REM Step %u\n",
+        "DELAY %u\n",
+        "GUI r\n",
+        "STRING powershell -NoProfile -WindowStyle Hidden\n",
+        "ENTER\n",
+        "STRINGLN Write-Host \"Hello World %u\"\n",
+        "STRING echo %u > C:\\Users\\Public\\log.txt\n",
+        "CTRL ALT DELETE\n"
+    };
+
+    void writeBenchFile(File& f, unsigned int i) {
+        char   line[64];
+        size_t len = 0;
+
+        for (unsigned int n = 0; len < BENCH_FILE_SIZE; ++n) {
+            const char* format = BENCH_LINES[n % (sizeof(BENCH_LINES) / sizeof(BENCH_LINES[0]))];
+            size_t l           = snprintf(line, sizeof(line), format, (i * 31 + n * 17) % 1000);
+
+            l    = _min(l, BENCH_FILE_SIZE - len);
+            len += f.write((uint8_t*)line, l);
+        }
+    }
+
+    // Reads every benchmark file, returns how long it took in us
+    unsigned long readBench(unsigned int files, bool packed, unsigned long& bytes) {
+        char buf[256];
+
+        bytes = 0;
+
+        unsigned long start = micros();
+
+        for (unsigned int i = 0; i < files; ++i) {
+            File f = filesystem->open(benchFile(i, packed), "r");
+
+            if (packed) f = packfile::open(f);
+
+            while (f.available()) bytes += f.read((uint8_t*)buf, sizeof(buf));
+            f.close();
+            yield();
+        }
+
+        return micros() - start;
+    }
+
+    String throughput(unsigned long bytes, unsigned long time) {
+        return String((uint64_t)bytes * 1000000 / (time > 0 ? time : 1));
+    }
+
+    // Takes seconds, only runs in the loop where yield() is allowed
+    String runBenchmark(unsigned int files) {
+        for (unsigned int i = 0; i < files; ++i) {
+            File f = filesystem->open(benchFile(i), "w");
+
+            writeBenchFile(f, i);
+            f.close();
+            yield();
+        }
+
+        // Listing
+        unsigned long start = micros();
+
+        listDir(BENCH_DIR, true);
+
+        unsigned long listTime = micros() - start;
+
+        // Opening
+        start = micros();
+
+        for (unsigned int i = 0; i < files; ++i) {
+            File f = filesystem->open(benchFile(i), "r");
+            f.close();
+        }
+
+        unsigned long openTime = micros() - start;
+
+        // Reading
+        unsigned long bytes;
+        unsigned long readTime = readBench(files, false, bytes);
+
+#ifdef ENABLE_FILE_COMPRESSION
+        // Compressed copies, read while they're decompressed
+        unsigned long packedSize = 0;
+
+        for (unsigned int i = 0; i < files; ++i) {
+            File src = filesystem->open(benchFile(i), "r");
+            File dst = filesystem->open(benchFile(i, true), "w");
+
+            packfile::pack(src, dst);
+            packedSize += dst.size();
+
+            src.close();
+            dst.close();
+        }
+
+        unsigned long packedBytes;
+        unsigned long packedReadTime = readBench(files, true, packedBytes);
+#endif // ifdef ENABLE_FILE_COMPRESSION
+
+        for (unsigned int i = 0; i < files; ++i) {
+            filesystem->remove(benchFile(i));
+#ifdef ENABLE_FILE_COMPRESSION
+            filesystem->remove(benchFile(i, true));
+#endif // ifdef ENABLE_FILE_COMPRESSION
+        }
+        if (directories) filesystem->rmdir(BENCH_DIR);
+
+        infoValid = false;
+
+        String res;
+
+        res += filesystemName;
+        res += " with " + String(files) + " files of " + String(BENCH_FILE_SIZE) + " byte\n";
+        res += "list " + String(listTime / 1000) + " ms\n";
+        res += "open " + String(openTime / files) + " us per file\n";
+        res += "read " + throughput(bytes, readTime) + " byte/s";
+#ifdef ENABLE_FILE_COMPRESSION
+        res += "\ncompressed " + String(packedSize / files) + " byte per file (" + String(packedSize * 100 / ((unsigned long)files * BENCH_FILE_SIZE)) + "%)\n";
+        res += "compressed read " + throughput(packedBytes, packedReadTime) + " byte/s";
+#endif // ifdef ENABLE_FILE_COMPRESSION
+
+        return res;
+    }
+
+#ifdef ENABLE_LITTLEFS
+    typedef struct migrated_file_t {
+        String   name;
+        uint8_t* data;
+        size_t   len;
+        migrated_file_t* next;
+    } migrated_file_t;
+
+    // Writes the files kept in RAM, returns false if one of them didn't fit
+    bool writeMigrated(fs::FS& fs, migrated_file_t* files) {
+        for (migrated_file_t* m = files; m; m = m->next) {
+            File   f       = fs.open(m->name, "w");
+            size_t written = f ? f.write(m->data, m->len) : 0;
+
+            f.close();
+
+            if (written != m->len) {
+                debugf("Couldn't write %s (%u of %u byte)\n", m->name.c_str(), written, m->len);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Copies the files of a SPIFFS partition into LittleFS.
+    // Both use the same flash, so the files are kept in RAM while it's formatted.
+    // If one of them can't be written, SPIFFS is formatted again and gets them back.
+    // Index and cache files are left out, they're made again when needed.
+    bool migrate() {
+        SPIFFSConfig spiffsConfig;
+        spiffsConfig.setAutoFormat(false);
+        SPIFFS.setConfig(spiffsConfig);
+
+        if (!SPIFFS.begin()) return false;
+
+        debugln("Migrating SPIFFS to LittleFS...");
+
+        migrated_file_t* files = NULL;
+        bool fits              = true;
+
+        Dir dir = SPIFFS.openDir("/");
+
+        while (fits && dir.next()) {
+            String name = dir.fileName();
+
+            if (lineindex::hidden(name)) continue;
+
+            File f = SPIFFS.open(name, "r");
+            if (!f) continue;
+
+            size_t len = f.size();
+            fits = ESP.getFreeHeap() > len + sizeof(migrated_file_t) + MIGRATE_HEAP_RESERVE;
+
+            migrated_file_t* m = fits ? new migrated_file_t { name, (uint8_t*)malloc(len + 1), len, files } : NULL;
+
+            if (m && m->data) {
+                f.read(m->data, len);
+                files = m;
+            } else {
+                delete m;
+                fits = false;
+            }
+
+            f.close();
+        }
+
+        bool migrated = false;
+
+        if (fits) {
+            SPIFFS.end();
+
+            migrated = LittleFS.format() && LittleFS.begin() && writeMigrated(LittleFS, files);
+
+            if (migrated) {
+                debugln("Migrated to LittleFS");
+            } else {
+                LittleFS.end();
+
+                bool restored = SPIFFS.format() && SPIFFS.begin() && writeMigrated(SPIFFS, files);
+
+                debugln(restored ? "Migration failed, staying on SPIFFS" : "Migration failed, files lost");
+            }
+        } else {
+            debugln("Not enough RAM to migrate, staying on SPIFFS");
+        }
+
+        while (files) {
+            migrated_file_t* next = files->next;
+            free(files->data);
+            delete files;
+            files = next;
+        }
+
+        return migrated;
+    }
+
+    void mount() {
+        LittleFSConfig littlefsConfig(false);
+        LittleFS.setConfig(littlefsConfig);
+
+        if (!LittleFS.begin() && !migrate()) {
+            // The files didn't fit into RAM or LittleFS
+            if (SPIFFS.begin()) return;
+
+            // Neither of them, a new flash
+            LittleFS.format();
+            LittleFS.begin();
+        }
+
+        filesystem     = &LittleFS;
+        filesystemName = "LittleFS";
+        directories    = true;
+    }
+
+#else // ifdef ENABLE_LITTLEFS
+    void mount() {
+        SPIFFS.begin();
+    }
+
+#endif // ifdef ENABLE_LITTLEFS
+
     // ===== PUBLIC ====== //
     void begin() {
-        debug("Initializing SPIFFS...");
-        SPIFFS.begin();
-        debugln("OK");
+        debug("Initializing file system...");
+        mount();
+        debugln(filesystemName);
 
         String FILE_NAME = "/startup_spiffs_test";
 
@@ -35,57 +622,78 @@ namespace spiffs {
             f.close();
             remove(FILE_NAME);
         }
+
+        scan();
     }
 
     void format() {
-        debug("Formatting SPIFFS...");
-        SPIFFS.format();
+        debugf("Formatting %s...", filesystemName);
+        filesystem->format();
         debugln("OK");
+
+        clearPack();
+
+        infoValid = false;
+        scan();
     }
 
     size_t size() {
-        FSInfo fs_info;
-
-        SPIFFS.info(fs_info);
-        return fs_info.totalBytes;
+        return fsInfo().totalBytes;
     }
 
     size_t usedBytes() {
-        FSInfo fs_info;
-
-        SPIFFS.info(fs_info);
-        return fs_info.usedBytes;
+        return fsInfo().usedBytes;
     }
 
     size_t freeBytes() {
-        FSInfo fs_info;
+        FSInfo& fs_info = fsInfo();
 
-        SPIFFS.info(fs_info);
         return fs_info.totalBytes - fs_info.usedBytes;
     }
 
     size_t size(String fileName) {
         fixPath(fileName);
 
-        File f = SPIFFS.open(fileName, "r");
+        if (ramdisk::contains(fileName)) return ramdisk::size(fileName);
 
-        return f.size();
+        int i = metaValid ? findMeta(fileName) : -1;
+
+        if (i >= 0) return meta[i].size;
+
+        File f = filesystem->open(fileName, "r");
+
+        return packfile::size(f);
     }
 
     bool exists(String fileName) {
-        return SPIFFS.exists(fileName);
+        fixPath(fileName);
+
+        if (ramdisk::contains(fileName)) return ramdisk::exists(fileName);
+
+        if (metaValid && !lineindex::hidden(fileName)) return findMeta(fileName) >= 0;
+
+        return filesystem->exists(fileName);
     }
 
     File open(String fileName) {
         fixPath(fileName);
 
-        return SPIFFS.open(fileName, "a+");
+        if (ramdisk::contains(fileName)) return ramdisk::open(fileName);
+
+        File f = filesystem->open(fileName, "a+");
+
+        int  i        = metaValid ? findMeta(fileName) : -1;
+        bool isPacked = (i >= 0) ? meta[i].packed : !lineindex::hidden(fileName) && packfile::packed(f);
+
+        // Opening creates it, and whatever is written changes the usage
+        infoValid = false;
+        if (f && (i < 0)) setMeta(fileName, isPacked ? packfile::size(f) : f.size(), isPacked);
+
+        return isPacked ? packfile::open(f) : f;
     }
 
     void create(String fileName) {
-        fixPath(fileName);
-
-        File f = SPIFFS.open(fileName, "a+");
+        File f = open(fileName);
 
         f.close();
     }
@@ -93,22 +701,55 @@ namespace spiffs {
     void remove(String fileName) {
         fixPath(fileName);
 
-        SPIFFS.remove(fileName);
+        erase(fileName);
+        lineindex::remove(fileName);
     }
 
     void rename(String oldName, String newName) {
         fixPath(oldName);
         fixPath(newName);
 
-        SPIFFS.rename(oldName, newName);
+        bool renamed;
+
+        if (ramdisk::contains(oldName) != ramdisk::contains(newName)) renamed = move(oldName, newName);
+        else if (ramdisk::contains(oldName)) renamed = ramdisk::rename(oldName, newName);
+        else renamed = filesystem->rename(oldName, newName);
+
+        if (!renamed) return;
+
+        renamePack(oldName, newName);
+        lineindex::rename(oldName, newName);
+
+        int i = findMeta(oldName);
+
+        if (i >= 0) {
+            file_meta_t m = meta[i];
+
+            removeMeta(oldName);
+            removeMeta(newName);
+            setMeta(newName, m.size, m.packed);
+        } else if (!lineindex::hidden(newName) && !ramdisk::contains(newName) && (findMeta(newName) < 0)) {
+            // A hidden file that became visible
+            File f = filesystem->open(newName, "r");
+
+            addMeta(newName, f.size());
+            f.close();
+        }
     }
 
     void write(String fileName, const char* str) {
+        fixPath(fileName);
+        unpack(fileName);
+
         File f = open(fileName);
 
         if (f) {
             f.println(str);
+            setMeta(fileName, f.size());
             f.close();
+            queuePack(fileName);
+            // Scripts are often written line by line, the index is built on the next run instead
+            lineindex::remove(fileName);
             debugln("Wrote file");
         } else {
             debugln("File error");
@@ -116,31 +757,46 @@ namespace spiffs {
     }
 
     void write(String fileName, const uint8_t* buf, size_t len) {
+        fixPath(fileName);
+        unpack(fileName);
+
         File f = open(fileName);
 
         if (f) {
             f.write(buf, len);
+            setMeta(fileName, f.size());
             f.close();
+            queuePack(fileName);
+            lineindex::remove(fileName);
             debugln("Wrote file");
         } else {
             debugln("File error");
         }
     }
 
-    String listDir(String dirName) {
+    String listDir(String dirName, bool all) {
         String res;
 
         fixPath(dirName);
 
-        Dir dir = SPIFFS.openDir(dirName);
-
-        while (dir.next()) {
-            res += dir.fileName();
-            res += ' ';
-            res += size(dir.fileName());
-            res += '\n';
+        if (metaValid && !all) {
+            for (size_t i = 0; i < metaLen; ++i) {
+                if (inDir(meta[i].name, dirName)) {
+                    res += meta[i].name;
+                    res += ' ';
+                    res += meta[i].size;
+                    res += '\n';
+                }
+            }
+        } else {
+            listing = String();
+            walk(dirName, all, addListing);
+            res = listing;
+            listing = String();
         }
 
+        res += ramdisk::listDir(dirName, all);
+
         if (res.length() == 0) {
             res += "\n";
         }
@@ -148,29 +804,68 @@ namespace spiffs {
         return res;
     }
 
+    bool benchmark(unsigned int files, benchmark_callback callback) {
+        if (benchCallback || !callback || (files == 0) || (freeBytes() < files * BENCH_FILE_SIZE * 2)) return false;
+
+        benchFiles    = files;
+        benchCallback = callback;
+
+        return true;
+    }
+
+    void update() {
+        if (benchCallback) {
+            String res = runBenchmark(benchFiles);
+
+            benchmark_callback callback = benchCallback;
+
+            benchCallback = NULL;
+            callback(res);
+        }
+
+        packUpdate();
+    }
+
+    String name() {
+        return filesystemName;
+    }
+
     void streamOpen(String fileName) {
         streamClose();
         streamFile = open(fileName);
         if (!streamFile) debugln("ERROR: No stream file open");
     }
 
-    void streamWrite(const char* buf, size_t len) {
-        if (streamFile) streamFile.write((uint8_t*)buf, len);
-        else debugln("ERROR: No stream file open");
+    // Returns false if not all of buf was written, e.g. when the RAM disk is full
+    bool streamWrite(const char* buf, size_t len) {
+        // A compressed file is decompressed before the first write
+        if (streamFile && !streamWritten && packed(streamFile.fullName())) {
+            String fileName = streamFile.fullName();
+
+            streamFile.close();
+            unpack(fileName);
+            streamFile = open(fileName);
+        }
+
+        if (streamFile) {
+            size_t written = streamFile.write((uint8_t*)buf, len);
+            streamWritten = true;
+
+            infoValid = false;
+            setMeta(streamFile.fullName(), streamFile.size());
+
+            return written == len;
+        } else {
+            debugln("ERROR: No stream file open");
+            return false;
+        }
     }
 
     size_t streamRead(char* buf, size_t len) {
-        if (streamFile) {
-            size_t i;
+        if (streamFile && (len > 0)) {
+            size_t i = streamFile.read((uint8_t*)buf, len - 1);
 
-            for (i = 0; i<len; ++i) {
-                if (!streamFile.available() || (i == len-1)) {
-                    buf[i] = '\0';
-                    break;
-                } else {
-                    buf[i] = streamFile.read();
-                }
-            }
+            buf[i] = '\0';
 
             return i;
         } else {
@@ -202,7 +897,15 @@ namespace spiffs {
     }
 
     void streamClose() {
-        streamFile.close();
+        if (streamFile && streamWritten) {
+            String fileName = streamFile.fullName();
+            streamFile.close();
+            queuePack(fileName);
+            lineindex::build(fileName);
+        } else {
+            streamFile.close();
+        }
+        streamWritten = false;
     }
 
     bool streaming() {
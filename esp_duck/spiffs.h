@@ -8,10 +8,25 @@
 #include <Arduino.h> // String
 #include <FS.h>      // File
 
+// Receives the result of a benchmark
+typedef void (* benchmark_callback)(const String& res);
+
+// Files are stored in SPIFFS, or in LittleFS with ENABLE_LITTLEFS.
+// Paths in /ram/ go to the RAM disk instead.
 namespace spiffs {
     void begin();
     void format();
 
+    // SPIFFS or LittleFS
+    String name();
+
+    // Creates, lists, opens and reads the given number of files in update(),
+    // callback gets the times it took. Returns false if there isn't enough space.
+    bool benchmark(unsigned int files, benchmark_callback callback);
+
+    // Runs what was started outside of the loop
+    void update();
+
     size_t size();
     size_t usedBytes();
     size_t freeBytes();
@@ -27,10 +42,11 @@ namespace spiffs {
     void write(String fileName, const char* str);
     void write(String fileName, const uint8_t* buf, size_t len);
 
-    String listDir(String dirName);
+    // Hidden files in /. are only listed with all
+    String listDir(String dirName, bool all = false);
 
     void streamOpen(String fileName);
-    void streamWrite(const char* buf, size_t len);
+    bool streamWrite(const char* buf, size_t len);
     size_t streamRead(char* buf, size_t len);
     size_t streamReadUntil(char* buf, char delimiter, size_t max_len);
     void streamClose();
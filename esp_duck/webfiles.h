@@ -38,7 +38,7 @@ const uint8_t error404_html[] PROGMEM = { 0x1f,0x8b,0x8,0x0,0x69,0x6b,0xf0,0x61,
 
 const uint8_t index_html[] PROGMEM = { 0x1f,0x8b,0x8,0x0,0x69,0x6b,0xf0,0x61,0x2,0xff,0xed,0x1a,0x6b,0x6f,0xe2,0xb8,0xf6,0xfb,0xfc,0xa,0x4f,0x56,0xba,0x6a,0xa5,0x42,0x68,0xbb,0xbb,0xda,0x9d,0x9b,0x46,0xa2,0x10,0x5a,0x54,0xa,0x88,0x4,0x55,0xb3,0x57,0x57,0x23,0x93,0x98,0x26,0xb7,0x49,0x8c,0x6c,0xa7,0x94,0xfd,0xf5,0xf7,0xd8,0xe,0x25,0xd,0x8f,0x5,0x66,0x9a,0xee,0x87,0xe5,0x3,0xc4,0xc7,0x3e,0xef,0x87,0x8f,0x83,0xad,0xcf,0xb5,0xda,0x27,0x4,0x1f,0x2f,0x8c,0x38,0xe2,0x74,0x2a,0xe6,0x98,0x11,0x4,0xcf,0x71,0xe4,0x93,0x94,0x93,0x0,0x65,0x69,0x40,0x18,0x12,0x21,0x41,0xf7,0x5d,0xf,0xf5,0x34,0xb8,0x8e,0x5c,0x42,0x14,0x30,0x5f,0x87,0xa6,0x51,0xc,0x5f,0x94,0xa1,0x80,0x8,0x1c,0xc5,0xbc,0xae,0xc8,0xba,0x34,0x63,0x3e,0xf9,0x82,0x42,0x21,0x66,0xfc,0x8b,0x69,0x3e,0x46,0x22,0xcc,0x26,0x75,0x9f,0x26,0x26,0x9f,0x61,0x9f,0x84,0x59,0x98,0xa,0xe2,0x87,0xe6,0x43,0xd4,0x89,0xda,0x99,0xff,0xf4,0xa9,0x56,0xb3,0x3f,0x59,0x9f,0xdb,0x83,0x96,0xf7,0x75,0xe8,0x0,0x5e,0x12,0xc3,0x58,0xff,0x48,0x82,0x56,0x48,0x70,0xa0,0x1f,0xd5,0x30,0x1,0x6e,0xc8,0xf,0x31,0xe3,0x44,0x5c,0x19,0x63,0xaf,0x53,0xfb,0xcd,0x28,0x4f,0xa7,0x38,0x21,0x57,0xc6,0x73,0x44,0xe6,0x33,0xca,0x84,0x81,0x7c,0xa,0x3c,0x53,0x58,0x3e,0x8f,0x2,0x11,0x5e,0x5,0xe4,0x19,0x74,0xa8,0xa9,0xc1,0x19,0x8a,0xd2,0x48,0x44,0x38,0xae,0x71,0x1f,0xc7,0xe4,0xaa,0x51,0xff,0xed,0xc,0x25,0x0,0x4b,0x0,0x94,0x45,0x5b,0x48,0x83,0x1d,0x12,0x52,0xf3,0x69,0x4c,0x59,0x81,0xfa,0x4f,0x97,0xbf,0x5e,0xfe,0x7e,0xe9,0x0,0xce,0x46,0xa4,0x80,0x70,0x9f,0x45,0x33,0x11,0xd1,0xb4,0x80,0x24,0xed,0x80,0xa4,0x21,0x8a,0xac,0x44,0x24,0x62,0x62,0xbf,0x4e,0x59,0xa6,0x6,0x14,0xe8,0xc6,0x51,0xfa,0x84,0x18,0x89,0xaf,0xc,0x2e,0x16,0x31,0xe1,0x21,0x21,0xa0,0xa8,0x58,0xcc,0xa4,0x74,0xe4,0x45,0x98,0x3e,0xe7,0x6,0xa,0x19,0x99,0xe6,0x2b,0xea,0x12,0x50,0x60,0xa1,0x65,0x41,0x9c,0xf9,0xb0,0x40,0x3d,0xd7,0xff,0x7,0xb,0x2c,0x53,0xf,0xb6,0xac,0x8c,0x20,0x36,0x5e,0x36,0x2c,0xb4,0xcc,0x95,0x9b,0xac,0x9,0xd,0x16,0x5,0xfc,0x14,0x3f,0xaf,0x46,0xa,0x92,0xc5,0xc8,0x8f,0x31,0xe7,0x57,0x46,0x42,0xd2,0xcc,0x78,0x3b,0x9b,0xab,0x67,0x5b,0x38,0x17,0x5f,0xf3,0x94,0x11,0x61,0x14,0x4d,0x82,0x41,0x4,0x58,0xb6,0x1b,0x17,0x82,0x44,0x44,0xe9,0x23,0xcf,0xd1,0xdd,0x7c,0xb8,0x27,0xb6,0x20,0xc,0x42,0x1,0xc7,0x39,0xb6,0x97,0xf,0xf7,0xc4,0xf6,0x19,0x9,0x22,0xb1,0x64,0xdd,0x9c,0xd0,0x4c,0x6c,0xc6,0xb4,0xcc,0x2c,0x2e,0xd8,0xcb,0x7c,0x63,0x30,0x2b,0x88,0x9e,0x51,0x14,0x48,0x2f,0x62,0x91,0x29,0xc3,0x3,0xa4,0x18,0x96,0x38,0x4a,0x4b,0xf4,0x38,0xf1,0x65,0x94,0x6d,0x90,0x2f,0x3c,0xb7,0x5d,0x45,0x7,0x1c,0x76,0xbe,0x61,0x5e,0x32,0xcb,0x5d,0xc3,0xe8,0x7c,0x83,0x67,0xd4,0xaa,0x99,0x6d,0x4d,0x80,0xe,0x65,0xf8,0x11,0x52,0xdd,0x32,0x27,0xb6,0x5,0xc9,0x9d,0x2a,0x31,0xa7,0x8c,0x90,0x7b,0x92,0x50,0xb6,0x30,0xec,0x9a,0x25,0x93,0x3e,0x5,0x91,0x67,0x5b,0x28,0x4d,0x32,0x21,0x68,0xba,0x64,0x19,0xe0,0xf4,0x91,0x40,0x46,0x29,0x3a,0x94,0x25,0x58,0x18,0xb6,0xfe,0x5,0x1e,0x6a,0xe5,0x5e,0x64,0xa0,0xa2,0xa5,0x46,0x6e,0x33,0x3a,0x33,0x6c,0xf9,0x7d,0x18,0x81,0x30,0x12,0x44,0x53,0x60,0x4,0x32,0x35,0x5,0x7b,0x1a,0xf6,0xeb,0xe3,0x76,0x5a,0x25,0xdf,0x68,0xd0,0x46,0x6f,0xfc,0x85,0x8f,0x54,0x6a,0x71,0x4,0xb1,0xb4,0xf4,0x6,0x89,0x29,0xe,0x72,0xad,0xf4,0xec,0x48,0x83,0xec,0x7f,0xfd,0xf4,0x72,0x71,0x3e,0x99,0xfc,0x5b,0x7,0xd7,0x46,0xb7,0xa,0x3c,0x81,0x62,0x9d,0x93,0x52,0x83,0x22,0x25,0x4f,0x1,0x0,0x57,0xcd,0x1c,0x1d,0x15,0x51,0x3a,0xcb,0x4,0x9a,0xc5,0xb2,0xca,0xd3,0x18,0xf6,0x90,0x2b,0xa3,0x3,0x7b,0x84,0x2c,0x7e,0xc8,0xb4,0xe4,0x8f,0x5d,0xac,0x50,0xc6,0x92,0x24,0x4f,0x28,0x15,0xa1,0x81,0x9e,0x71,0x9c,0xc1,0x9c,0xa9,0x45,0x4b,0xc9,0x5c,0x62,0x1b,0xe6,0x5e,0x1e,0xe3,0x99,0xef,0x13,0x59,0xf1,0x68,0xea,0xc3,0x6,0xf5,0xa4,0xb2,0xf,0xb,0x72,0xf2,0x48,0xc4,0x37,0x20,0xf5,0x6d,0x9a,0x4b,0x72,0x72,0x7a,0x6a,0xd8,0x7a,0xee,0xfd,0xdd,0xe8,0x40,0xfe,0xc3,0x6,0xb9,0xd9,0x8b,0x44,0x4d,0x1e,0xe0,0xc4,0x8f,0xf0,0x82,0x16,0x52,0x39,0xe2,0xe0,0xc,0xd6,0xb8,0x6d,0x12,0x13,0x48,0x26,0x3b,0x50,0xbf,0x7,0xa5,0xe1,0x8c,0xc1,0x2e,0xc,0x75,0xa4,0x48,0x8d,0xce,0x53,0x6d,0xb0,0x20,0x7f,0xfa,0x5e,0x8a,0xcd,0xc,0xbe,0xb2,0xd4,0xb0,0x9d,0x54,0x25,0x9,0xd6,0xe3,0x83,0x82,0xe3,0x0,0xf7,0x48,0x9b,0x43,0xc3,0x85,0xcb,0x66,0x5f,0x9,0xa4,0x12,0x31,0x5f,0xf5,0xa3,0xb9,0x17,0x56,0x5,0x64,0x92,0x3d,0x4a,0x5f,0x6d,0x5e,0x2a,0x3f,0x83,0x4c,0x40,0x2c,0x41,0x81,0x7f,0x2d,0xee,0x5a,0xc2,0x28,0x9d,0x52,0xa8,0xaa,0xf8,0x99,0x4,0x79,0x81,0xdf,0xcc,0x6d,0x8b,0xa8,0xdf,0xad,0xc1,0x4a,0x92,0x5a,0xee,0xd0,0x9a,0x76,0x16,0xdf,0xa1,0xcc,0xb6,0x82,0xb1,0x22,0xe6,0x82,0x42,0x5a,0xad,0xdd,0x31,0xb5,0x73,0xc7,0xc9,0xb3,0x5a,0x6,0xd4,0xce,0x28,0xda,0x3b,0x7f,0xdc,0x7d,0xb7,0xb0,0xbd,0xad,0x7d,0x78,0x29,0x83,0x33,0x83,0x2c,0x67,0x6d,0xea,0x67,0xd0,0xb0,0x41,0xff,0x0,0xcb,0x54,0x91,0x92,0xbd,0xfb,0x7a,0xe1,0xbb,0xc8,0xf7,0x2f,0xe8,0xb4,0x60,0xd5,0xc5,0xa6,0x25,0x97,0xf6,0x35,0xe6,0x91,0x2f,0xdb,0x90,0xcb,0xd,0xf3,0x5b,0xda,0x85,0x3b,0xb2,0xe0,0x48,0x1e,0x57,0x38,0x99,0x61,0x6,0x25,0x3c,0x40,0x93,0x5,0xc2,0x88,0x3,0x27,0x48,0x5d,0x75,0xc0,0xa8,0x5b,0x13,0xb6,0x19,0xdb,0x79,0x26,0x6c,0x21,0x42,0x58,0x8b,0xe6,0x2c,0x12,0xd0,0x7e,0x43,0xef,0xbf,0xc2,0x86,0x8e,0x9a,0x20,0xd8,0x2e,0x38,0x9a,0x31,0x88,0xc,0xa0,0x8d,0xd3,0x40,0xb6,0xd8,0x4,0xab,0x81,0x50,0xa7,0x1f,0x2e,0xeb,0xa8,0x88,0x92,0x1d,0x7c,0x3c,0xaa,0xe8,0xc3,0x32,0xc8,0xe2,0x33,0x94,0x71,0x7d,0x6e,0x72,0xbd,0x51,0xb7,0x7f,0x83,0xa6,0x59,0xaa,0xcc,0x5c,0xdf,0xe0,0xaa,0xd9,0xb6,0xad,0x7b,0x5b,0x31,0x79,0x7b,0x36,0x5a,0x9f,0x67,0xdb,0x27,0x73,0x2,0xb6,0xf3,0x82,0x93,0x59,0xc,0x21,0xf,0xcf,0x7b,0x2c,0x86,0x8d,0x25,0xcd,0xfd,0xbf,0xb,0x1,0x66,0xd9,0xb6,0x38,0xdd,0x21,0xb5,0x25,0xde,0x9e,0x1d,0x8e,0xd0,0x28,0xb0,0x1f,0xba,0xfd,0xf6,0xe0,0xc1,0xdd,0xb9,0x4e,0xa7,0x1e,0xb3,0x11,0xdb,0x4d,0xce,0x14,0xc1,0x5f,0x33,0xf4,0x60,0x37,0x55,0x2e,0x7e,0x80,0xa3,0xa,0x9d,0x73,0xf4,0x44,0x16,0x2a,0x78,0x0,0x96,0xaa,0x9,0x26,0x41,0xbb,0x89,0x6d,0xb7,0xd8,0xa1,0x8a,0x23,0xb6,0x9f,0xd8,0x43,0x19,0xe6,0xdb,0xe4,0xd6,0x22,0x43,0x6e,0x24,0x59,0x2c,0x70,0x4a,0x68,0xc6,0xe3,0xf7,0xd7,0x20,0xcf,0x91,0x3,0x15,0x79,0x50,0xd9,0xb6,0x27,0xd2,0xce,0xc8,0xdc,0x1c,0x7d,0xdb,0x1b,0x63,0x28,0x5e,0x9d,0x3c,0x9f,0xb7,0x95,0x32,0xdd,0x7a,0xcb,0x7a,0x1e,0xc0,0xb1,0x75,0x51,0x5b,0xe6,0x3f,0xaf,0xe9,0x3e,0xfc,0x1d,0x53,0xbb,0x45,0x93,0x4,0xdc,0xb9,0x6f,0x6a,0x1f,0x50,0x7,0xda,0xab,0x57,0x19,0x7f,0xdf,0x3a,0x60,0xf9,0x34,0x20,0xf6,0xc8,0xb9,0xb7,0x4c,0xf5,0xb4,0x5f,0x30,0xbd,0x62,0xa1,0x5b,0x12,0xc7,0x14,0x3d,0x50,0x16,0x7,0x9f,0xf,0x22,0x21,0xed,0xe,0xdb,0xe4,0xbb,0x67,0x8b,0x16,0xb5,0xed,0x74,0x9a,0xe3,0x9e,0xd7,0x76,0x7a,0xcd,0xaf,0xb9,0x98,0x48,0x1e,0x3a,0x8a,0x93,0xdf,0x8a,0xb3,0x87,0xd8,0xa1,0x48,0x1c,0x5d,0x34,0x1a,0x7,0x91,0xf0,0x60,0x9b,0x94,0x5b,0x6c,0xc2,0xd1,0x84,0x88,0x39,0x81,0x62,0x48,0xe4,0x1e,0x8c,0xfc,0xd7,0xc0,0xac,0xc6,0x40,0xc7,0xea,0x2e,0x95,0x3e,0x6f,0x1c,0xa8,0x35,0x1c,0x78,0xf0,0x42,0xab,0x5d,0x91,0x82,0xba,0x6a,0x1e,0xa1,0x61,0x5e,0x6e,0x8f,0xe,0x74,0xb9,0xf1,0xe9,0x1d,0x64,0x4a,0x81,0xc4,0x5c,0xb6,0x56,0x5c,0x30,0xd5,0xf7,0x55,0xa2,0xf9,0xc8,0x19,0x3a,0x4d,0x6f,0x2d,0xea,0x1,0x7c,0x9c,0xcb,0x35,0x3d,0x74,0x79,0x10,0xea,0x88,0xcc,0x8,0x16,0xda,0xe,0xd0,0xc5,0x8b,0x65,0x78,0xa3,0x54,0x35,0x8a,0x55,0x45,0x41,0x6f,0xd0,0x6a,0xf6,0x9c,0x23,0x94,0xd6,0x88,0xa8,0x7d,0x18,0xae,0x4b,0x72,0x95,0xa1,0x4d,0x98,0x50,0xcc,0x2,0xd0,0x7d,0x41,0x33,0x51,0x47,0xcd,0x67,0x1c,0xc5,0x72,0x6f,0xfb,0xf2,0x5a,0x84,0x72,0xca,0x67,0x39,0xe0,0xe6,0xba,0x4,0x18,0xbb,0x25,0x80,0x53,0x6,0x74,0x46,0x25,0x40,0xfb,0xae,0x4,0x18,0x8d,0x4b,0x80,0xeb,0x32,0xdb,0xa1,0x57,0x2,0x74,0xcb,0x0,0xb7,0x4c,0xb4,0xf5,0x47,0x79,0x45,0xb7,0xcc,0xe5,0xa6,0x8c,0xd2,0xac,0xad,0x9,0xdb,0xba,0xad,0xad,0x19,0x1,0x60,0x6b,0xeb,0x6e,0x97,0x3a,0x7c,0x47,0x57,0xfa,0xc3,0x2,0xea,0xce,0xf9,0xda,0x1a,0xb4,0x8f,0x89,0xa8,0x1c,0x13,0x35,0x5e,0x1a,0x17,0xf2,0xeb,0xe7,0x23,0xaa,0xa,0x9c,0xcb,0x66,0xc4,0x8f,0xa6,0x91,0xaf,0x1a,0x51,0x89,0x8f,0x4e,0x12,0x1a,0x0,0x84,0xb0,0x33,0x9,0x3b,0xff,0xcf,0x19,0xaa,0xd7,0xeb,0xea,0xf9,0xd7,0xff,0x9e,0xca,0x92,0x1b,0x0,0x46,0x82,0x63,0x59,0x9,0x42,0xf2,0x82,0xf3,0x61,0x55,0x9,0xe8,0xb4,0x8f,0xc9,0x3e,0xa7,0x8d,0x7e,0x6e,0xc0,0xde,0xa,0x3b,0xcd,0x61,0x5d,0x46,0x28,0xdf,0x15,0xe8,0x1c,0x54,0xff,0x44,0x21,0x3a,0x55,0x3,0x49,0xb1,0x60,0x8b,0xd1,0xcd,0xb5,0x7e,0xa9,0xc7,0xd1,0x49,0xa3,0x76,0xf1,0xcb,0x2f,0xa7,0xd5,0x36,0xc8,0x2e,0x1c,0x1f,0x2,0x59,0x1f,0xe4,0xe9,0x7d,0x57,0x93,0xfc,0x8e,0x9d,0xf0,0x9d,0x3a,0x7d,0xfd,0xad,0xfb,0x54,0xbc,0xdc,0xc5,0x6a,0x79,0x2d,0xf8,0x73,0xaf,0x68,0xf8,0x61,0xd1,0xdb,0x2c,0xf3,0xff,0xa3,0x5a,0xfe,0x8d,0x32,0xff,0xdf,0xab,0xe5,0xdf,0x39,0x2f,0xb,0xd0,0x39,0xbf,0xf8,0x4e,0x11,0x8e,0x4b,0x98,0xfb,0xbc,0xc8,0xfd,0x93,0x30,0x3b,0x1d,0xd6,0xf2,0x46,0xbd,0xb5,0xce,0xaf,0x35,0xe8,0x7b,0xa3,0x41,0xaf,0xda,0xd0,0x71,0x6f,0xbb,0x1d,0xaf,0xe2,0x6c,0xed,0x55,0xcc,0x30,0x7f,0xbb,0xb2,0x66,0xf0,0x9b,0x71,0xf7,0x43,0x92,0x64,0x0,0x41,0xf6,0x4f,0x86,0xec,0xf6,0x99,0xd3,0xf7,0x9c,0x51,0xb5,0x61,0x72,0xef,0xf4,0xc7,0x6b,0x31,0xd2,0x1c,0xe,0xab,0x95,0x2,0x4e,0xee,0x8e,0xe7,0x54,0xcb,0xf3,0x76,0x70,0x5f,0x31,0xc7,0x6e,0xdf,0x75,0x46,0x15,0x97,0x81,0x61,0xf3,0xc6,0x19,0xf,0xab,0xe7,0x9,0xb5,0xa7,0x5f,0x2d,0xd7,0x57,0x2d,0x57,0x71,0x3c,0x1e,0x36,0x47,0xa3,0xc1,0x43,0xc5,0xb1,0xbc,0xd2,0xbc,0xf0,0x5a,0xf,0x80,0x1f,0x20,0x4b,0xcf,0xe9,0xac,0xbf,0x6c,0x91,0xc0,0xf,0x90,0x65,0xd4,0xbd,0xb9,0xdd,0xf0,0xe6,0x47,0x42,0x3f,0x40,0x1a,0xaf,0x79,0x5d,0x2d,0x43,0xa7,0xdf,0xae,0x98,0xa1,0xdb,0x5a,0xb3,0x36,0xc0,0x9a,0xc3,0x8a,0xab,0x9e,0x3b,0x6c,0xb6,0x9c,0xaa,0xb,0xd0,0xd8,0x75,0xa4,0xd6,0xd7,0x23,0xa7,0x79,0x57,0x2d,0x6f,0x30,0xb0,0xdb,0x1b,0xb4,0x2a,0xe6,0xda,0x1f,0xdf,0x57,0xcf,0x74,0x38,0xea,0xf6,0x3d,0xb7,0x35,0x72,0x9c,0x8a,0x4b,0x3d,0xf0,0x1c,0xf4,0x7a,0x3f,0x40,0xe1,0xc3,0x5a,0xd9,0xd,0xf7,0x30,0x2c,0xf3,0xed,0x6d,0x4e,0x6b,0x4a,0xa9,0x20,0x25,0x6e,0xaf,0x17,0x4c,0xf7,0xbe,0x63,0x6d,0x20,0x81,0xd9,0xa3,0xbc,0x2f,0xfd,0x6d,0x12,0xe3,0xf4,0xc9,0xb0,0xf5,0x35,0x6d,0x79,0xd9,0xec,0x53,0xf9,0x2f,0xf1,0xb5,0x7b,0xd,0xab,0xeb,0x3f,0xcf,0x84,0x71,0x79,0x7b,0xd9,0x5e,0xde,0xeb,0x2c,0x2f,0x6d,0xd1,0xd9,0x82,0x45,0x8f,0xa1,0x40,0x27,0xfe,0x29,0xba,0x68,0x5c,0x9c,0x23,0x77,0x29,0x11,0xf2,0x40,0xa4,0x94,0xc6,0xf4,0x31,0x22,0x7c,0x9d,0x49,0x59,0xa9,0x57,0x4d,0xa4,0x5e,0xeb,0xa,0xbc,0x99,0x7e,0xa3,0x87,0x65,0x16,0x8d,0x66,0x99,0xda,0x23,0x70,0x4a,0x50,0x57,0xca,0xff,0xf,0xb9,0x16,0xaa,0x7d,0x0,0x2f,0x0,0x0 };
 
-const uint8_t index_js[] PROGMEM = { 0x1f,0x8b,0x8,0x0,0x69,0x6b,0xf0,0x61,0x2,0xff,0xad,0x59,0x6d,0x6f,0x1b,0xb9,0x11,0xfe,0xae,0x5f,0x41,0x2f,0xd0,0x8b,0x14,0x1b,0x5a,0xfb,0xd0,0x7e,0x89,0x6c,0x7,0x69,0x13,0x5f,0x3,0x9c,0xef,0x8a,0x38,0xbd,0xa0,0xa8,0xf,0x2,0xbd,0x4b,0x59,0x84,0x57,0x5c,0x95,0xe4,0x5a,0xa7,0xde,0xf9,0xbf,0xdf,0xcc,0xf0,0x65,0xdf,0xad,0xb8,0xbd,0x7c,0x70,0x56,0xcb,0xe1,0x70,0x5e,0x9f,0x99,0xe1,0xa6,0xaf,0x27,0x8c,0xb1,0xcf,0x6b,0x69,0x98,0x29,0x57,0x76,0xc7,0xb5,0x60,0xf0,0x5c,0xc8,0x4c,0x28,0x23,0x72,0x56,0xa9,0x5c,0x68,0x66,0xd7,0x82,0x5d,0x7f,0xfc,0xcc,0xbe,0x77,0xaf,0xe7,0xec,0x46,0x8,0x7a,0xe9,0xe9,0xd8,0x4a,0x16,0xf0,0xa7,0xd4,0x2c,0x17,0x96,0xcb,0xc2,0xcc,0x91,0xeb,0x4d,0x59,0xe9,0x4c,0xbc,0x61,0x6b,0x6b,0xb7,0xe6,0x4d,0x9a,0xde,0x4b,0xbb,0xae,0xee,0xe6,0x59,0xb9,0x49,0xcd,0x96,0x67,0x62,0x5d,0xad,0x95,0x15,0xd9,0x3a,0xfd,0x22,0xaf,0xe4,0xfb,0x2a,0x7b,0x98,0xb0,0xd7,0xe9,0x64,0x32,0x49,0x53,0x76,0x11,0xff,0xb1,0xef,0x8a,0xf2,0x8e,0x17,0xec,0x27,0xae,0x25,0xbf,0x2b,0x84,0x69,0xae,0xa5,0x29,0x51,0x1f,0x81,0x60,0xc6,0xb2,0x72,0x45,0x72,0x18,0xa6,0x85,0xad,0xb4,0x2,0xe9,0xef,0xf6,0x2c,0x29,0x4c,0xc2,0xe0,0xc8,0xd,0x57,0xf9,0xe4,0x91,0x6b,0x22,0x59,0x16,0x48,0x7f,0xc1,0x92,0x64,0xe1,0x19,0x4,0xf6,0xcc,0x96,0xcc,0xf0,0x47,0x30,0x2,0x88,0xa6,0x1f,0xe1,0x60,0xd4,0xaa,0xda,0xe6,0xdc,0x4a,0x75,0xcf,0x8c,0xe5,0xb6,0x32,0xc0,0x4f,0xc1,0xcf,0xb2,0x32,0xc5,0x9e,0x78,0xba,0xd7,0xcb,0xb8,0xe7,0x82,0xec,0xb6,0x92,0x20,0x43,0x38,0xe0,0x9f,0xa,0xd9,0xe6,0xb4,0x55,0x28,0xb,0xfc,0xc9,0x80,0x22,0x97,0xb6,0xd4,0xc4,0xa4,0x72,0x14,0xcb,0x6c,0xcd,0xd5,0x3d,0x50,0x5e,0xb0,0x15,0x2f,0x8c,0x8,0xc,0xae,0xa,0x7e,0xcf,0xe4,0xca,0xef,0x60,0x6b,0xe,0x5e,0x2a,0x79,0xe,0x84,0xdc,0x99,0x7f,0x2f,0x6c,0xad,0x60,0xb9,0x15,0xaa,0xcb,0xa3,0x6f,0xd4,0xab,0x4a,0x65,0x56,0x96,0x6a,0xc8,0xa8,0xee,0xc7,0x4f,0xbc,0xa8,0x4,0xfb,0x4e,0x58,0xd0,0xcc,0x53,0x21,0xc1,0xca,0x6f,0x64,0xf7,0xc2,0x2e,0x95,0xd8,0x2d,0xf1,0x50,0xc5,0x37,0x62,0x3a,0x63,0xbf,0x82,0xef,0x9d,0x7,0xd8,0x87,0x69,0x2,0x8b,0x57,0xb0,0x96,0xcc,0xe6,0x8f,0xc8,0x6a,0x31,0x79,0x9a,0xb4,0x77,0x3b,0x7d,0xc6,0x19,0xb8,0xf5,0x71,0x1e,0x66,0x80,0x47,0x78,0x38,0xcc,0xb,0x2d,0xe4,0x89,0x47,0x45,0xf3,0x2e,0xf3,0x92,0xa1,0x89,0x83,0x13,0x2f,0x6a,0xa6,0xb5,0x70,0x40,0x3,0x6e,0x9a,0x1e,0x79,0xa2,0xb9,0x50,0xb9,0xf9,0x2,0xa1,0x3f,0x4d,0x6e,0x55,0x32,0x9b,0x61,0x66,0x34,0x18,0x84,0xa7,0x63,0x86,0xcb,0xb4,0xdb,0xcb,0xeb,0x57,0x48,0x2c,0x17,0x42,0x18,0x85,0x22,0xc4,0x60,0x5,0x21,0x58,0x30,0x69,0x5f,0x19,0xa6,0x4a,0x8,0x5,0x88,0x19,0xcd,0x12,0x5d,0x29,0x5,0x81,0x9a,0xd4,0x8a,0x64,0x6b,0x91,0x3d,0x2c,0xdd,0x26,0xaf,0x2,0x8a,0x97,0x55,0x5a,0x3,0x77,0xbf,0x30,0x97,0x2a,0x2b,0xaa,0x5c,0x98,0x69,0xe4,0x30,0x63,0xbf,0xfd,0xc6,0x46,0xa9,0x20,0x54,0x89,0xc8,0xa9,0xb3,0x33,0x4b,0x4a,0x11,0x11,0xcf,0x59,0xc0,0x7b,0x1,0x91,0x47,0xcb,0xc6,0x96,0xdb,0x65,0x27,0x47,0x90,0x24,0x28,0x76,0x63,0xb9,0xb6,0x75,0xc6,0xd9,0x35,0xb7,0x4e,0x6c,0xc3,0x20,0x6b,0x5d,0xf6,0x41,0x5a,0x63,0xbe,0xc,0x24,0x60,0x1d,0x9,0xc8,0xa6,0x7f,0x4e,0x54,0xb9,0xb3,0x32,0xf3,0x86,0x5e,0x30,0x14,0xe2,0x9c,0xfd,0xa8,0x8a,0xbd,0x67,0xc,0x71,0x1,0x1b,0xba,0x59,0xad,0x4a,0x8b,0xd1,0x86,0x2e,0x1a,0x50,0xd8,0x73,0x81,0x54,0x9,0x56,0xf3,0xc,0x26,0x6c,0x0,0x1f,0x80,0xcf,0xc7,0x20,0x61,0xd3,0x43,0x27,0xec,0x2f,0xa7,0xa7,0x91,0x59,0xdb,0x30,0xd,0x7b,0x95,0xdb,0x3f,0xc2,0x5c,0x43,0x5e,0x89,0xd6,0x3a,0xfa,0x7f,0xcd,0xb5,0x3,0x84,0xf2,0xe6,0x1a,0x90,0x9a,0x24,0x85,0xd2,0x61,0x31,0xa1,0x8,0x7a,0x81,0x2e,0x2b,0x4,0xd7,0xd1,0x2e,0x5d,0x1,0x16,0x83,0x96,0x6c,0x20,0x6d,0xb0,0xcf,0xbb,0x2d,0xa0,0x5f,0xe,0xb4,0x1a,0x31,0x1b,0x11,0x3d,0xd3,0x72,0x6b,0x43,0x46,0xd5,0x26,0xe0,0x44,0x8,0x7,0x69,0xa7,0x77,0x2f,0x9b,0xd9,0xf1,0x5,0xb2,0xe9,0xe6,0xa0,0x71,0x88,0x4b,0x55,0x4,0x15,0xd9,0x88,0x4d,0xa9,0xf7,0xac,0x32,0xfc,0x5e,0xd4,0xdc,0x7d,0x84,0xc4,0x82,0xe3,0x8d,0xb,0xb1,0x63,0xf0,0xd4,0x4,0x76,0x25,0x27,0x2c,0x90,0x4f,0x37,0xe6,0xde,0x11,0x38,0x8c,0x29,0x40,0x27,0x40,0x5c,0x6,0xaf,0xe7,0x66,0x5b,0x48,0x3b,0x4d,0x6f,0x55,0x4a,0x46,0x60,0x8c,0xfe,0xc8,0xd5,0x94,0x88,0xe6,0x80,0x5f,0xf7,0x76,0xd,0xe8,0xcc,0xce,0x2,0x7,0x82,0x18,0x53,0x16,0x62,0x2e,0xb4,0x2e,0xf5,0x34,0xb9,0xe6,0x5,0x54,0xb2,0xd,0xd4,0x4,0x2d,0xcc,0x16,0xd6,0xc4,0x9b,0xc4,0x33,0xeb,0xd2,0xa2,0x20,0x61,0xc5,0xfb,0x9c,0x7e,0x3d,0x4d,0xa2,0x70,0x77,0x7b,0x8b,0xd0,0x49,0xc7,0xff,0xfb,0xf4,0x67,0x2f,0x60,0xc2,0x92,0x19,0xfc,0x5a,0x44,0xb2,0xca,0x50,0xd,0x72,0x64,0x67,0xa3,0x64,0x2b,0x2d,0x6a,0x6e,0xdf,0xf6,0xc8,0x22,0xdd,0x56,0x40,0x3f,0x41,0xa8,0x79,0xcd,0xed,0x7a,0xbe,0x2a,0x4a,0x90,0x96,0x44,0x49,0xd9,0x19,0xa6,0x4d,0x8b,0xe3,0x20,0x35,0x1d,0x95,0x6,0x4e,0x33,0xcf,0x1c,0xfc,0x8e,0xb,0xd7,0xe4,0x46,0xf0,0xbd,0x54,0x4a,0xe8,0xbf,0x7f,0xbe,0xfe,0x1e,0xe3,0xb,0x75,0x0,0x74,0x76,0x3a,0xd3,0x2f,0x10,0xed,0xb8,0x75,0x4,0x2c,0xff,0x89,0x5e,0xcc,0x12,0xcf,0xb1,0xd7,0x65,0x78,0x98,0x74,0x9e,0x87,0x9e,0xa4,0xe1,0xf8,0xcc,0x3c,0xd6,0x6e,0xab,0x37,0x42,0xe8,0xc1,0x8a,0xdf,0xda,0x8e,0x89,0x48,0xd4,0x8f,0xc,0x47,0x68,0x31,0xa1,0xbc,0x2,0xc9,0x39,0x20,0x1,0xcf,0x2f,0x43,0x79,0xc1,0x7f,0xf5,0xfa,0x31,0x11,0x68,0xb7,0x3a,0xbc,0xb8,0xbe,0xc4,0x8a,0x79,0x9e,0xc2,0xc3,0xb3,0x54,0x7f,0x5,0x3,0x1d,0xa6,0x7a,0xe7,0x3a,0x8e,0x3,0x84,0xe9,0xb3,0x22,0xa5,0xd,0x8d,0x86,0xcf,0xb9,0x2b,0xf3,0x7d,0x4b,0x63,0x6c,0xe3,0xa6,0x68,0x1a,0x9,0x26,0x39,0x5d,0xc0,0x7f,0xe7,0xac,0x99,0x3d,0xf0,0xe6,0xf8,0xb8,0x76,0x83,0x33,0x23,0xe4,0x2f,0x8f,0x81,0x29,0x9b,0x81,0xb9,0x68,0xd1,0xa1,0x3f,0x7e,0x80,0x16,0x2,0x68,0x71,0x4b,0xc,0xee,0xe6,0xfa,0x8d,0xfc,0x6f,0x5c,0x3f,0xfb,0x39,0xca,0xe5,0xc0,0x36,0x30,0x8,0xa9,0x7c,0xc9,0x4e,0x9b,0xb2,0x38,0x22,0x89,0x19,0x7e,0xca,0xbe,0xf9,0x86,0x1d,0x35,0x7a,0xbc,0x36,0x1d,0x66,0x2c,0xcf,0x23,0xbf,0x86,0x9c,0x98,0xbf,0xf5,0xf3,0xb3,0x1,0x30,0x44,0x90,0x5f,0x52,0xd0,0x7,0x45,0x8f,0xc9,0xb,0xf9,0xd7,0xef,0x22,0xf5,0xbf,0x7a,0xd7,0xf3,0x4,0x77,0x95,0xb5,0xd8,0xd9,0x14,0xdc,0x98,0x8b,0xdb,0x64,0xab,0xe5,0x86,0xeb,0xfd,0x6d,0xc2,0x4a,0xe8,0x4f,0x64,0xf6,0x0,0xef,0xc8,0xa,0xaf,0xba,0x22,0xbf,0x9a,0xdd,0x26,0x97,0x88,0xf0,0xe7,0xa9,0xe3,0xf1,0xb2,0x83,0x60,0x3a,0x52,0xed,0x53,0x2a,0x35,0x72,0x8,0xac,0x7c,0xe5,0x19,0x69,0xd7,0xf6,0xc1,0x4d,0x4f,0x63,0xb1,0xdf,0x8b,0x6d,0x80,0x2f,0x57,0xe1,0x3e,0x23,0x69,0x7,0xbf,0xe2,0x76,0xf,0xe2,0x14,0x12,0x4f,0x8d,0xee,0xeb,0xa,0xca,0x2,0x74,0x10,0x37,0xff,0xf8,0x78,0x75,0x75,0x53,0x57,0xaf,0x15,0xbd,0x6e,0x76,0x8c,0xa5,0x5a,0x49,0xbd,0x99,0x26,0xad,0xd,0x6f,0xdd,0xf0,0xb8,0x93,0x45,0x1,0xc3,0x5f,0x21,0x0,0x23,0x39,0x3c,0x3a,0x79,0xcc,0x11,0x74,0x88,0x3e,0x3e,0x23,0xf8,0x39,0xc6,0x0,0x80,0x45,0x79,0xbf,0xdc,0x19,0x1f,0xa2,0xbc,0x10,0xda,0x6,0xde,0x34,0x6b,0x11,0x4b,0xcb,0x1f,0x80,0x21,0xdb,0x40,0x93,0x61,0xc5,0xfc,0x56,0xfd,0xab,0xac,0x60,0xf4,0x79,0xa4,0x39,0x4d,0xb,0x10,0x49,0x89,0xc,0x6a,0xf0,0xa,0xda,0x1,0xf0,0x4e,0x6e,0xe6,0x2e,0x35,0x9f,0xa2,0x76,0x9f,0x2a,0xe5,0x85,0xa9,0x55,0x43,0xb7,0xc5,0xc,0x69,0xd7,0x64,0x58,0x62,0xb7,0x89,0x73,0xe9,0x2f,0x57,0x9e,0xa6,0x41,0x8c,0x6d,0x7a,0xd2,0x96,0x7d,0xa4,0xed,0x5c,0xb4,0xdb,0x35,0xdf,0x56,0x33,0xb3,0x15,0x99,0x5c,0xc9,0xac,0x27,0x14,0xb6,0x63,0x63,0x52,0xe1,0xda,0xb,0xc4,0x3a,0x61,0x56,0x57,0x62,0x4c,0x82,0x86,0x7b,0xda,0xa7,0xbf,0x2b,0x8a,0xe9,0xc0,0xc1,0xe3,0x6c,0x3f,0x9,0xe8,0x74,0x8d,0x4,0x6f,0x60,0xba,0x41,0x1,0x2c,0x37,0xd8,0x2d,0x9,0xbe,0x69,0xd8,0x1a,0x56,0x96,0xee,0x65,0x97,0x39,0x2e,0xb5,0xea,0xa0,0x6b,0xcf,0x42,0xc0,0xf8,0x98,0xa3,0xe9,0xe8,0x8,0x22,0xff,0x92,0x7d,0xf8,0xe1,0x7d,0x52,0xc3,0xdd,0x60,0xb3,0x16,0x87,0xa6,0x1a,0xc,0xe3,0xe9,0xe1,0xa5,0x6f,0xd9,0xe9,0x7c,0x30,0xc8,0x7c,0x3e,0xf,0x78,0xfe,0x44,0x33,0x4b,0x3c,0x21,0x4a,0x9a,0x15,0xa5,0x11,0xdd,0x88,0x1d,0x1b,0x7b,0x5c,0xe6,0x36,0x33,0xec,0x47,0x0,0x6a,0x6f,0x18,0x8c,0x5b,0x37,0xaf,0xb7,0x4d,0xd4,0xf1,0x7c,0x3b,0x18,0x28,0xd1,0x1b,0x35,0x66,0x30,0x6,0x88,0x68,0x6c,0x18,0x8e,0xb5,0xa0,0x6f,0xb4,0xd8,0x9f,0x34,0x9c,0x4e,0x92,0x86,0x78,0xab,0x91,0xad,0x1d,0xf9,0x93,0xae,0x79,0xfd,0x60,0xf0,0x89,0x62,0x1,0xfb,0x63,0xef,0xc,0xc3,0xa6,0x3a,0x44,0x4a,0xb1,0x9f,0x5,0x65,0xea,0x3b,0xa,0xc,0xab,0xda,0x5a,0x7f,0x3,0x76,0x88,0x22,0x4c,0x89,0x5d,0xc7,0x52,0x19,0x2d,0xfd,0x41,0xb6,0xa,0x75,0xd7,0x35,0x52,0x71,0xb4,0x6d,0x2a,0xcc,0x6a,0xf8,0xea,0x97,0xd5,0x56,0xb0,0x1c,0x34,0xfc,0xb3,0xa6,0x6f,0x86,0x9a,0xd3,0xfe,0x90,0xf1,0x71,0x4f,0x7f,0xbe,0x68,0x43,0xdf,0x7b,0xf,0xc7,0xbd,0x70,0xdb,0x94,0x8f,0x87,0x8c,0xd8,0x4a,0x53,0xa4,0x7f,0x29,0x2a,0xe,0xb,0xd7,0xbf,0xe3,0x8a,0xbe,0xaf,0x87,0xb2,0xa,0x6c,0x34,0x8e,0xd0,0x38,0x32,0x7a,0x92,0x97,0xc9,0x14,0xcc,0xf2,0x45,0x4b,0x1b,0x63,0x13,0xf3,0xb1,0x6d,0x9e,0x1d,0x2e,0x47,0x3e,0x27,0xac,0x85,0x4a,0xff,0x6b,0xac,0xf5,0x8d,0x99,0x5a,0xb1,0xd9,0x96,0x1a,0xfa,0x96,0xa5,0x3,0xe3,0xae,0x1,0xfb,0x11,0x71,0x60,0xcb,0x60,0xa,0x1f,0xde,0x83,0xfd,0xa9,0xdf,0xb7,0x84,0xf7,0xa8,0xc6,0xc0,0x44,0x1a,0x30,0xd3,0xdd,0xfb,0x34,0x20,0xd3,0xb1,0x8a,0x33,0xe3,0x53,0xe4,0xb9,0x7d,0xb0,0xc6,0xb5,0xbc,0x67,0xa7,0xdf,0xfe,0xd9,0x99,0x6a,0xa0,0x7,0xa7,0xd9,0x2c,0x13,0xb2,0x8,0x58,0x1f,0x5a,0xe0,0x34,0x70,0x98,0xb5,0x5a,0x73,0x9a,0x3e,0xc5,0xbd,0x54,0xc0,0x42,0xb2,0xd7,0x81,0xa8,0x1e,0xfd,0x70,0xf2,0xbf,0xf0,0x24,0xc7,0xed,0x65,0xcc,0x78,0x5c,0xbe,0x64,0xed,0xb3,0x66,0x7e,0x53,0xfb,0x6d,0x3b,0x33,0x97,0x9a,0xef,0xa2,0x88,0xa6,0xba,0x73,0x97,0xb,0x53,0x3a,0xe7,0x4,0xf7,0xcf,0x4e,0x9a,0x66,0xf4,0xa9,0x38,0x79,0xae,0x88,0x3c,0x93,0x64,0xe3,0x69,0xdf,0xd8,0x81,0x20,0x33,0xec,0xe2,0xaf,0xc1,0xee,0xa1,0xe2,0x15,0xfb,0x5,0xec,0xb0,0x8,0xc2,0xe9,0x72,0x9,0xfa,0x3b,0x7f,0xa5,0x55,0xec,0x19,0xa2,0x76,0xe7,0xf6,0xba,0xee,0x22,0x60,0x5f,0xa8,0xf2,0x94,0x46,0x83,0x17,0xbc,0x27,0x83,0x97,0xab,0x23,0xf8,0xe0,0xef,0xaf,0x1b,0xf0,0x29,0xd5,0xaa,0xec,0xf4,0xb8,0x9,0xed,0x4a,0xc6,0x70,0x27,0x76,0xba,0x41,0xce,0xa8,0x15,0xf4,0x42,0x70,0xa,0x34,0xf4,0xee,0x73,0xc6,0x4e,0xdc,0x99,0x32,0x7b,0x10,0x74,0x55,0x84,0x9d,0x25,0x1,0x2,0x37,0x4c,0x18,0x6c,0xa3,0xa5,0x59,0x8b,0xbc,0x81,0x14,0x66,0xe9,0xc9,0x44,0xee,0xb5,0x1e,0x3f,0xbd,0x71,0xc1,0x4e,0xb7,0x7a,0xd5,0xb6,0x73,0xe7,0xbe,0x93,0x2a,0x2f,0x77,0x73,0x9e,0xe7,0x1f,0x1e,0xc1,0x20,0xf8,0x45,0x3,0xca,0xa3,0x9e,0x26,0x78,0xcb,0xdf,0x6c,0x93,0xe2,0x55,0x55,0xec,0x7f,0xc1,0x1a,0x7e,0x26,0x1,0x5b,0xec,0xb0,0x9,0x95,0xd6,0x9b,0xcc,0x37,0x7a,0x9f,0x4,0x71,0x69,0xd2,0x75,0x45,0xf5,0x1b,0x7c,0x77,0xde,0xa4,0x74,0xaf,0x2,0x43,0xec,0x8,0x9b,0xab,0xbe,0x73,0xa4,0x98,0x8a,0x3e,0x1a,0x38,0xaf,0x23,0xbf,0xaf,0xa8,0x83,0x1,0xd2,0x40,0x92,0xc8,0x11,0x43,0xb2,0x7d,0x2e,0xbc,0x68,0x93,0xb8,0x7a,0xf7,0xfc,0xa1,0xad,0x41,0xc6,0x17,0x48,0x4c,0x95,0xe1,0x2f,0x11,0x90,0x37,0x6f,0xeb,0x16,0x80,0x85,0xd2,0x39,0x2e,0xb4,0xef,0xfd,0x3a,0x72,0x95,0x3b,0x75,0xd8,0x1c,0xb9,0xa7,0x5a,0xda,0x5f,0xec,0x8b,0xf3,0xa6,0x6b,0xac,0xae,0x93,0x7a,0xa7,0x51,0x21,0x7b,0xc6,0xf8,0x6d,0x6f,0x56,0xea,0xb0,0x55,0x3b,0xa9,0x5b,0x1b,0xcd,0x81,0x42,0xeb,0xa,0x11,0xcb,0xfb,0x57,0x7b,0x9e,0x8e,0x7e,0x10,0x7b,0xcc,0x98,0xfe,0xd1,0x63,0x1d,0x45,0xab,0xe3,0x1a,0x82,0x8c,0x2a,0x7c,0x90,0xa3,0x8d,0x26,0xe9,0xab,0xfd,0xce,0x75,0x19,0x2f,0x8,0x28,0x1c,0x36,0x2d,0x7d,0x4b,0x75,0x17,0xce,0xd8,0xa7,0x40,0xea,0x48,0xc4,0x19,0x40,0x4e,0xff,0x89,0xa2,0xda,0xbe,0x75,0x83,0x6c,0xc6,0x15,0xcb,0xa5,0xa1,0xef,0x8e,0x32,0x7e,0x12,0x84,0x6,0x7,0xe7,0x5f,0x1c,0x65,0x67,0xde,0x84,0xa1,0x25,0x3a,0xe0,0x30,0x2,0xb9,0x6b,0x9a,0x98,0x61,0xc6,0x3b,0xcf,0xca,0x5c,0x5c,0x1a,0x7f,0xc9,0x8d,0x8d,0x4e,0xd,0xd9,0x6c,0xb7,0x16,0x78,0xaf,0x1,0x4a,0x1,0xa2,0x85,0x8f,0x5a,0x39,0x5d,0x2e,0xe6,0x65,0x56,0x6d,0xb0,0xca,0xfd,0xa7,0x12,0x7a,0x7f,0x3,0x39,0x92,0xa1,0x31,0x60,0x38,0x4c,0x90,0xc4,0x15,0xfe,0xa1,0x52,0x4e,0xc,0x86,0xae,0xd3,0x68,0x1,0xef,0xcf,0xfa,0xe0,0x46,0x22,0xf4,0xd1,0x8d,0x94,0x76,0x97,0xf3,0x68,0xcf,0x86,0xe7,0xb0,0x2b,0xc7,0xef,0x68,0xad,0xdb,0xc,0x5f,0xcf,0x10,0xf7,0x8,0x71,0x4f,0x5c,0xd9,0x98,0x2d,0x7e,0x7,0xce,0xe3,0xaa,0x72,0xdf,0x1e,0x0,0x0 };
+const uint8_t index_js[] PROGMEM = { 0x1f,0x8b,0x8,0x0,0xa9,0x28,0xd5,0x6a,0x2,0xff,0xad,0x5a,0x6d,0x73,0xdb,0x36,0x12,0xfe,0xae,0x5f,0x1,0x73,0xe6,0x1a,0x29,0xf6,0x88,0x76,0x7a,0xf7,0x25,0xb2,0xec,0x49,0x9b,0x38,0xc9,0x5c,0x7c,0xe9,0xd8,0x6e,0x73,0x37,0x71,0x46,0x3,0x91,0x90,0xc4,0x31,0x5,0xaa,0x4,0x68,0x45,0x77,0xf5,0x7f,0xbf,0xdd,0xc5,0xb,0x41,0x89,0x94,0xed,0x69,0xf3,0xc1,0x91,0x88,0xc5,0x62,0xb1,0x2f,0xcf,0xbe,0x50,0xf1,0xcb,0x1e,0x63,0xec,0x66,0x91,0x29,0xa6,0x8a,0x99,0x5e,0xf3,0x52,0x30,0xf8,0x9c,0x67,0x89,0x90,0x4a,0xa4,0xac,0x92,0xa9,0x28,0x99,0x5e,0x8,0x76,0xf9,0xf1,0x86,0x7d,0x32,0x8f,0x87,0xec,0x5a,0x8,0x7a,0x68,0xe9,0xd8,0x2c,0xcb,0xe1,0x4f,0x51,0xb2,0x54,0x68,0x9e,0xe5,0x6a,0x88,0x5c,0xaf,0x8b,0xaa,0x4c,0xc4,0x6b,0xb6,0xd0,0x7a,0xa5,0x5e,0xc7,0xf1,0x3c,0xd3,0x8b,0x6a,0x3a,0x4c,0x8a,0x65,0xac,0x56,0x3c,0x11,0x8b,0x6a,0x21,0xb5,0x48,0x16,0xf1,0x97,0xec,0x22,0x7b,0x5b,0x25,0x77,0x3d,0xf6,0x32,0xee,0xf5,0x7a,0x71,0xcc,0xc6,0xfe,0x1f,0x7b,0x9f,0x17,0x53,0x9e,0xb3,0xdf,0x78,0x99,0xf1,0x69,0x2e,0x54,0xb8,0x16,0xc7,0x44,0x7d,0x0,0x82,0x29,0xcd,0x8a,0x19,0xc9,0xa1,0x58,0x29,0x74,0x55,0x4a,0x90,0x7e,0xba,0x61,0x51,0xae,0x22,0x6,0x47,0x2e,0xb9,0x4c,0x7b,0xf7,0xbc,0x24,0x92,0x49,0x8e,0xf4,0x63,0x16,0x45,0x23,0xcb,0xc0,0xb1,0x67,0xba,0x60,0x8a,0xdf,0x83,0x12,0x40,0xb4,0xf2,0x1e,0xe,0xc6,0x5b,0x55,0xab,0x94,0xeb,0x4c,0xce,0x99,0xd2,0x5c,0x57,0xa,0xf8,0x49,0xf8,0x5a,0x54,0x2a,0xdf,0x10,0x4f,0xf3,0x78,0xe2,0xf7,0x8c,0x49,0x6f,0xb3,0xc,0x64,0x70,0x7,0xfc,0x2a,0x91,0x6d,0x4a,0x5b,0x85,0xd4,0xc0,0x9f,0x14,0x28,0xd2,0x4c,0x17,0x25,0x31,0xa9,0xc,0xc5,0x24,0x59,0x70,0x39,0x7,0xca,0x31,0x9b,0xf1,0x5c,0x9,0xc7,0xe0,0x22,0xe7,0x73,0x96,0xcd,0xec,0xe,0xb6,0xe0,0x60,0xa5,0x82,0xa7,0x40,0xc8,0x8d,0xfa,0x37,0x42,0xd7,0x17,0x2c,0x56,0x42,0xb6,0xf0,0x28,0xc1,0x6e,0xd3,0x8d,0x6,0x1d,0x81,0xb2,0xf0,0xfc,0xab,0x37,0x97,0x2c,0xcd,0xd4,0x1d,0xeb,0xc7,0x25,0x5f,0xc6,0x83,0xa6,0xee,0x96,0x62,0xd9,0x54,0x1e,0xd0,0x4c,0x66,0xc8,0x64,0xcc,0x8e,0x47,0x1d,0x96,0xba,0xa8,0x64,0xa2,0xb3,0x42,0xb6,0x59,0xca,0x7c,0xf9,0x8d,0xe7,0x95,0x60,0xef,0x85,0x6,0x75,0x59,0x2a,0x24,0x98,0xd9,0x8d,0x6c,0x2e,0xf4,0x44,0x8a,0xf5,0x4,0x6f,0x22,0xf9,0x52,0xf4,0x7,0xec,0x7f,0xe0,0x50,0x46,0x34,0xf6,0xae,0x1f,0xc1,0xe2,0x5,0xac,0x45,0x83,0xe1,0x3d,0xb2,0x1a,0xf5,0x1e,0x7a,0xcd,0xdd,0x46,0x49,0xdd,0xc,0xcc,0x7a,0x37,0xf,0xd5,0xc2,0xc3,0x7d,0x78,0x9c,0x17,0xaa,0xdd,0x12,0x77,0x8a,0x66,0xfd,0xc0,0x4a,0x86,0xba,0x75,0x9e,0x31,0xae,0x99,0xd6,0xc2,0x1,0xd,0xd8,0xbe,0x7f,0x60,0x89,0x86,0x42,0xa6,0xea,0xb,0xc4,0x53,0x3f,0xba,0x95,0xd1,0x60,0x80,0xe1,0x16,0x30,0x70,0x9f,0xe,0x19,0x2e,0xd3,0x6e,0x2b,0xaf,0x5d,0x21,0xb1,0x8c,0x5f,0xa2,0x6b,0xb,0xe7,0xd8,0x15,0xf8,0x75,0xce,0x32,0xfd,0x42,0x31,0x59,0x80,0x7f,0x81,0x23,0x96,0x2c,0x2a,0x2b,0x29,0xc1,0xfb,0xa3,0xfa,0x22,0xc9,0x42,0x24,0x77,0x13,0xb3,0xc9,0x5e,0x1,0xc5,0x4b,0xaa,0xb2,0x4,0xee,0x76,0x61,0x98,0xc9,0x24,0xaf,0x52,0xa1,0xfa,0x9e,0xc3,0x80,0xfd,0xf1,0x7,0xeb,0xa4,0x2,0xff,0x27,0x22,0x73,0x9d,0xb5,0x9a,0x50,0xdc,0x9,0x7f,0xce,0x8,0x9e,0xb,0x70,0x67,0x5a,0x56,0xba,0x58,0x4d,0xb6,0x2,0xf,0x49,0xdc,0xc5,0xae,0x35,0x2f,0x75,0x1d,0xc6,0x7a,0xc1,0xb5,0x11,0x5b,0x31,0xf0,0x66,0x13,0xd2,0x10,0x7,0x18,0x4,0x2d,0x51,0x5d,0x7b,0x2,0xb2,0xd9,0x3d,0xc7,0x5f,0x79,0x6b,0xc5,0x5,0xd0,0x88,0xa1,0x10,0xa7,0xec,0xb3,0xcc,0x37,0x96,0x31,0xf8,0x5,0x6c,0xd8,0x86,0xa,0x59,0x68,0xf4,0x36,0x34,0x51,0xcb,0x85,0x2d,0x17,0x8,0x15,0xa7,0x35,0xcb,0xa0,0xc7,0x5a,0x40,0x7,0xf8,0x7c,0x74,0x12,0x86,0x16,0x3a,0x62,0xff,0x38,0x3e,0xf6,0xcc,0x9a,0x8a,0x9,0xf4,0x55,0xac,0xfe,0xa,0x75,0xb5,0x59,0xc5,0x6b,0xeb,0xe0,0xcf,0xaa,0x6b,0xd,0xb0,0x67,0xd5,0xd5,0x22,0x35,0x49,0xa,0xf9,0x48,0x63,0x40,0x11,0x9e,0x3,0x5d,0x92,0xb,0x5e,0x7a,0xbd,0x6c,0xb,0x30,0x6a,0xd5,0x64,0x0,0xdf,0x4e,0x3f,0x6f,0x56,0x0,0xa9,0x29,0xd0,0x96,0x98,0x8,0x30,0x4d,0x24,0x65,0xb6,0xd2,0x2e,0xa2,0x6a,0x15,0x70,0x22,0x84,0x83,0x4a,0x73,0xef,0x9d,0x68,0x66,0x87,0x63,0x64,0xb3,0x1d,0x83,0xca,0xc0,0x38,0xa5,0x26,0xbc,0x8,0x80,0x6f,0x51,0x6e,0x58,0xa5,0xf8,0x5c,0xd4,0xdc,0xad,0x87,0xf8,0x2c,0x66,0x95,0xb,0xbe,0xa3,0xf0,0x54,0x82,0xec,0x23,0xe6,0xc8,0xfb,0x4b,0x35,0x37,0x4,0x6,0x63,0x72,0xb8,0x13,0x20,0x2e,0x83,0xc7,0x43,0xb5,0xca,0x33,0xdd,0x8f,0x6f,0x65,0x4c,0x4a,0x60,0x8c,0xfe,0x64,0xb3,0x3e,0x11,0xd,0x1,0xbf,0xe6,0x7a,0x1,0xe8,0xcc,0x4e,0x1c,0x7,0x82,0x18,0x55,0xe4,0x62,0x28,0xca,0xb2,0x28,0xfb,0xd1,0x25,0xcf,0x21,0x3d,0x2e,0x21,0x5b,0x94,0x42,0xad,0x60,0x4d,0xbc,0x8e,0x2c,0xb3,0x6d,0x5a,0x14,0xc4,0xad,0x58,0x9b,0xd3,0xb7,0x87,0x9e,0x17,0xe,0x13,0x13,0xc8,0x46,0xc7,0x7f,0x3d,0xfe,0x66,0x5,0x8c,0x58,0x34,0x80,0x6f,0x23,0x4f,0x56,0x29,0x4a,0x6c,0x86,0xec,0xa4,0x93,0xcc,0xa6,0x29,0x43,0xf6,0x6a,0x87,0x8c,0xe8,0x82,0x74,0xb6,0xe2,0xa5,0x12,0x13,0xf7,0xc0,0xe8,0x60,0x30,0xaa,0x85,0x5b,0x9,0xa8,0x65,0x8,0x5c,0x2f,0xb9,0x5e,0xc,0x67,0x79,0x1,0x97,0x22,0x89,0x63,0x76,0x82,0xd1,0xd5,0x38,0xb8,0x95,0x9a,0x4e,0x8a,0x1d,0x27,0xc7,0x1c,0xdc,0x3,0x17,0x2e,0xc9,0xda,0xe0,0x22,0x99,0x94,0xa2,0xfc,0x70,0x73,0xf9,0x9,0xdd,0x10,0xaf,0xa,0x20,0x6e,0x54,0x43,0xdf,0xe0,0x6,0x87,0x8d,0x23,0x60,0xf9,0x6f,0xf4,0x60,0x10,0x59,0x8e,0x3b,0x15,0x8e,0x45,0x53,0xe3,0x20,0x50,0xf,0x5,0xfe,0x91,0xa8,0xfb,0xda,0xba,0xf5,0x46,0xf0,0x50,0x58,0xb1,0x5b,0x9b,0xae,0xe3,0x89,0x76,0x1d,0xc8,0x10,0x6a,0x8c,0x3b,0x7b,0x81,0xe8,0x14,0x0,0x83,0xa7,0x67,0x2e,0xb,0xe1,0xbf,0x7a,0xfd,0x90,0x8,0x4a,0xb3,0xda,0xbe,0xb8,0x38,0xc3,0xc4,0x7a,0x1a,0xc3,0x87,0xbd,0x54,0x3f,0x81,0x82,0x1e,0xa7,0x7a,0x63,0xa,0x93,0x47,0x8,0xe3,0xbd,0x22,0xc5,0xc1,0x8d,0xda,0xcf,0x99,0x16,0xe9,0xa6,0x71,0x63,0x2c,0x21,0xfb,0xa8,0x9a,0x8c,0xea,0x26,0xf8,0xef,0x94,0x85,0x41,0x6,0x4f,0xe,0xf,0x6b,0x33,0x18,0x35,0x42,0x98,0x73,0xef,0xbf,0x59,0xe8,0xbf,0xa3,0x6,0x1d,0xda,0xe3,0x5f,0x50,0x69,0x0,0x2d,0x6e,0xf1,0x31,0x10,0xae,0x5f,0x67,0xff,0xf5,0xeb,0x27,0xdf,0xbc,0x5c,0x6,0x93,0x1d,0x3,0x17,0xf1,0x67,0xec,0x38,0x94,0xc5,0x10,0x65,0x8,0x4,0xc7,0xec,0x87,0x1f,0xd8,0x41,0x50,0x5f,0x36,0xe9,0x30,0xb0,0x79,0xea,0xf9,0x5,0x72,0x62,0x98,0xd7,0x9f,0xf7,0x3a,0x40,0x1b,0x41,0x7a,0x46,0x4e,0xef,0x2e,0x7a,0x48,0x56,0x48,0x9f,0xbe,0x8b,0xae,0xff,0xe4,0x5d,0xfb,0x9,0xa6,0x95,0xd6,0x58,0x0,0xe5,0x5c,0xa9,0xf1,0x6d,0xb4,0x2a,0xb3,0x25,0x2f,0x37,0xb7,0x11,0x2b,0xa0,0x8c,0xc9,0x92,0x3b,0x78,0x46,0x5a,0x78,0xb1,0x2d,0xf2,0x8b,0xc1,0x6d,0x74,0x86,0x89,0xe0,0x34,0x36,0x3c,0x9e,0x77,0x10,0x74,0x66,0xb2,0x79,0x4a,0x25,0x3b,0xe,0x81,0x95,0x27,0x9e,0x11,0x6f,0xeb,0xde,0x99,0xe9,0xa1,0xcb,0xf7,0x77,0x7c,0x1b,0xe0,0xcb,0x24,0xc2,0x1b,0x24,0xdd,0xc2,0x2f,0xbf,0xdd,0x62,0x3d,0xb9,0xc4,0x43,0x50,0xa4,0x5d,0x40,0xf6,0x80,0x42,0xe3,0xfa,0x97,0x8f,0x17,0x17,0xd7,0x75,0x92,0x9b,0xd1,0xe3,0xb0,0xb0,0x2c,0xe4,0x2c,0x2b,0x97,0xfd,0xa8,0xb1,0xe1,0xdc,0x34,0xae,0xeb,0x2c,0xcf,0xa1,0xf1,0xcc,0x5,0x60,0x24,0x87,0x8f,0x46,0x1e,0x75,0x0,0x85,0xa4,0xf5,0x4f,0xf,0x7e,0x86,0x31,0x0,0x60,0x5e,0xcc,0x27,0x6b,0x65,0x5d,0x94,0xe7,0xa2,0xd4,0x8e,0x37,0xf5,0x79,0xc4,0x52,0xf3,0x3b,0x60,0xc8,0x96,0x50,0x8b,0x68,0x31,0xbc,0x95,0xff,0x29,0x2a,0x68,0xbb,0xee,0xa9,0x47,0x2c,0x5,0x88,0x24,0x45,0x2,0xa9,0x7a,0x6,0x55,0x3,0x58,0x27,0x55,0x43,0x13,0x9a,0xf,0xfe,0x76,0x57,0x95,0xb4,0xc2,0xd4,0x57,0x43,0xb3,0xf9,0x8,0x69,0xa6,0x6e,0x58,0x62,0xb7,0x91,0x31,0xe9,0xf7,0xb,0x4b,0x13,0x10,0x63,0x35,0x1f,0x35,0x65,0xef,0xa8,0x4e,0x47,0xcd,0xaa,0xce,0x56,0xdf,0x4c,0xad,0x44,0x92,0xcd,0xb2,0x64,0x47,0x28,0xac,0xda,0xba,0xa4,0xc2,0xb5,0x67,0x88,0x75,0xc4,0x74,0x59,0x89,0x2e,0x9,0x2,0xf3,0x34,0x4f,0x7f,0x93,0xe7,0xfd,0x96,0x83,0xbb,0xd9,0xbe,0x2d,0xd6,0x12,0xfb,0x5f,0xd7,0xfd,0xc2,0xe5,0x8b,0xa0,0xa3,0x3e,0xc2,0x6,0xbb,0x90,0x2,0xc,0xf5,0x7b,0x25,0x14,0xd6,0xbb,0x4a,0x43,0x5c,0x62,0xdf,0x8b,0x8f,0x29,0x48,0x23,0xcc,0xc5,0xec,0x9f,0x3f,0x5,0xd6,0x69,0x0,0x18,0xc9,0xd3,0xd4,0xd,0xf9,0x7d,0x0,0xb9,0xad,0x2a,0x21,0xa2,0xae,0x16,0xd2,0x43,0xe3,0x6e,0x5d,0xe8,0xd3,0xb5,0xad,0xff,0x49,0x48,0x50,0xdb,0x70,0x48,0xae,0x65,0xfb,0x44,0x77,0xa3,0x31,0x83,0x36,0x98,0xfd,0xfb,0xf2,0xd3,0x7,0xad,0x57,0x57,0xe6,0x61,0x7f,0x60,0x9b,0x3d,0xfa,0x36,0x2c,0x8c,0x8a,0xc6,0x75,0xbe,0x77,0x11,0x81,0x41,0xe5,0xa8,0x6c,0x3d,0xf,0x0,0xff,0xea,0x38,0x80,0xfe,0x36,0xf9,0xdc,0x16,0x57,0xee,0xdd,0x88,0xef,0xda,0xc6,0x36,0x75,0x66,0x7e,0x33,0x58,0xad,0x1f,0x7d,0xfd,0x70,0x73,0xf3,0xcb,0x37,0x86,0xae,0xd3,0xb6,0x71,0xe0,0x2a,0xc0,0xee,0x6e,0xef,0xa1,0x79,0x1d,0x48,0x3a,0xfd,0xe8,0xfd,0xbb,0x1b,0x70,0x8b,0x28,0x46,0x65,0x9e,0xa3,0x5a,0xc7,0x78,0x80,0x90,0x49,0x91,0x8a,0x5f,0xaf,0x3e,0xfe,0x5c,0x2c,0xe1,0x4,0x6c,0xad,0xbd,0xb6,0x89,0x95,0xbf,0x2d,0x3a,0x57,0x6d,0xc7,0x7a,0x52,0x82,0xe,0x56,0xfb,0xd7,0xcf,0xa0,0x7b,0xc4,0x13,0x52,0x32,0x12,0x6,0xcd,0x2f,0x2d,0xfd,0x45,0x6e,0xe2,0x32,0xb0,0x29,0xa9,0x7c,0x2f,0x1c,0x82,0x3a,0xab,0x81,0x6c,0x37,0xc1,0x36,0xf4,0xfe,0xa8,0xcf,0xed,0xf5,0xba,0x20,0xf6,0xcc,0x15,0x7d,0xd8,0xd7,0xb2,0x6c,0x3,0x10,0x6b,0x69,0x48,0x9a,0x20,0xf8,0xd6,0x2,0xf3,0x96,0x12,0x4b,0xa8,0x77,0xef,0x1f,0x53,0x62,0x8,0x8e,0x44,0xff,0x5c,0x7c,0x6c,0x17,0x6e,0x77,0xd2,0xe6,0x6d,0x5f,0x77,0x71,0x15,0xe8,0xa8,0x1b,0xab,0xb1,0xc7,0xb4,0x24,0xcf,0x93,0xc9,0xe7,0x6,0xea,0x81,0x4c,0x43,0x3d,0xeb,0x1e,0xcb,0xcd,0xca,0x62,0x49,0x4f,0x5c,0xe0,0x20,0x5,0x35,0x79,0xb5,0xa8,0xad,0xad,0x4b,0x38,0xa4,0x6a,0x34,0x74,0x67,0xec,0x47,0x76,0x6e,0xf6,0x40,0x53,0x6c,0xa8,0xbf,0xfe,0xb8,0xd5,0x1f,0xd,0xd8,0x6b,0x1c,0xf0,0x39,0x61,0xbf,0x94,0x19,0x98,0xd0,0x4d,0x95,0x0,0x68,0x9b,0xb6,0x5c,0xe3,0xb2,0xbf,0xf4,0x91,0x23,0xfc,0x73,0x81,0x1,0x7,0x5f,0x6b,0x8e,0xe6,0x1,0x24,0x47,0x7d,0xac,0x17,0x42,0xb2,0x4c,0xc3,0x16,0xd,0xe9,0x40,0x15,0x80,0xe3,0xf9,0xc6,0xe8,0x2f,0x93,0x38,0xa8,0xa5,0x34,0xa0,0x48,0x1a,0x38,0x9e,0xc4,0x84,0xe2,0x69,0x31,0x34,0xcc,0x3e,0x3,0x65,0x69,0x7,0xc4,0x4b,0xbe,0x31,0x99,0x7c,0x2a,0x84,0xf4,0x1b,0x14,0x44,0x9f,0x1d,0x6b,0x73,0xc0,0x57,0xdb,0x4a,0xc3,0x41,0x1c,0xc,0xc1,0xe7,0x3c,0x93,0xc3,0x5e,0xdd,0xa9,0x2a,0x1a,0x13,0x8,0x95,0xf0,0x95,0xe8,0xb7,0xa0,0x8f,0x53,0xc2,0xc0,0x15,0xf9,0xbd,0xa7,0xb5,0xe9,0xdd,0x3d,0xe9,0x56,0xd3,0xee,0x1a,0x48,0x85,0x5a,0xda,0xd5,0xfe,0x91,0x95,0xf2,0xb4,0xe6,0x78,0xe,0xa8,0x89,0x53,0x5e,0x2d,0x40,0xc8,0x12,0xca,0xd6,0x89,0xc9,0xc5,0x11,0x58,0x3b,0xda,0x7d,0xba,0x53,0xad,0x91,0x1b,0xa8,0xd0,0xf,0xf4,0x72,0x85,0xe6,0xa3,0x79,0x5,0x99,0xa3,0x14,0xab,0x9c,0x27,0x76,0x96,0x41,0x36,0x6,0x80,0xc3,0xac,0xf,0x6e,0xb,0xb6,0xc3,0xf1,0x8d,0x55,0x77,0x63,0xc4,0xd6,0x7e,0x1,0xcb,0xbd,0x1e,0x91,0xce,0x38,0x7c,0xd,0xa7,0xda,0x5d,0x0,0xe1,0xe4,0x6a,0x81,0x84,0x76,0x8c,0xeb,0xdc,0xd0,0xac,0x48,0x60,0xcb,0xf2,0x9,0x3b,0x50,0x56,0xbb,0x6b,0x2,0xcf,0xc3,0x4,0x1c,0x58,0xda,0x65,0x79,0x33,0xf6,0xb4,0x49,0xde,0x26,0x4f,0x60,0x65,0x47,0x26,0x3e,0x5d,0xa3,0xf9,0x33,0x99,0x8a,0xef,0x9f,0x67,0xfd,0xe8,0xdd,0xd5,0xd5,0xe7,0xab,0x68,0xc0,0xce,0xc6,0xd8,0xad,0x79,0xbd,0x18,0x1c,0x73,0x79,0x93,0xe6,0x16,0x77,0x5a,0x99,0xee,0xef,0xe4,0xf8,0xd5,0xdf,0x4d,0xf8,0xb5,0xb4,0xa3,0x34,0xa6,0x48,0x44,0x96,0x3b,0xbf,0x75,0x70,0x11,0x3b,0xe,0x83,0x46,0x97,0x4a,0x51,0x20,0xe6,0x10,0x9a,0x63,0xd8,0xff,0xd2,0x11,0xd5,0x53,0x10,0x9c,0x95,0x8d,0x2d,0xc9,0x61,0x73,0x19,0x2f,0x83,0xcb,0x67,0xac,0x79,0xd6,0xc0,0x6e,0x6a,0x3e,0x6d,0xa6,0x26,0x88,0x86,0xb5,0x17,0x51,0x55,0x53,0x33,0x8e,0xeb,0xd3,0x39,0x47,0xb8,0x7f,0x70,0x14,0x6a,0xde,0xe6,0xa2,0x86,0xd9,0xf3,0x42,0x89,0x8e,0xd8,0x6b,0x57,0xfc,0x81,0x51,0x6f,0x5d,0x19,0x75,0x25,0xa5,0x7d,0x69,0xb2,0xb1,0xb,0x13,0x73,0x9b,0x1b,0x3d,0x89,0xd3,0x56,0xa5,0xf5,0xcc,0x0,0xb0,0xbb,0x20,0x9e,0x6f,0x1a,0x79,0x6,0x1a,0x1e,0x7c,0xdd,0xb7,0xc2,0x42,0x7b,0x63,0xd0,0x8e,0x61,0x27,0x86,0x8,0xda,0xab,0xe7,0x0,0x8e,0xef,0xc1,0xb8,0x15,0x31,0x82,0x79,0x40,0x67,0x54,0x77,0x21,0xcd,0xee,0x6c,0xd0,0x4f,0x7,0xeb,0x58,0xa1,0x61,0x62,0x4d,0xef,0xab,0x99,0x4c,0xce,0x8a,0xad,0xe6,0x33,0x4a,0x8a,0x2a,0x4f,0xe5,0xb,0x6d,0x5e,0xe8,0x85,0x8a,0x75,0xdb,0xbb,0xa,0x81,0xe0,0xe8,0xf6,0xba,0xb4,0xb3,0xec,0x9,0x1b,0x1f,0x3c,0x95,0x92,0x12,0xd,0xd3,0x21,0x33,0xd9,0x11,0x3e,0xc0,0x24,0x16,0x9d,0x5b,0xaf,0x0,0x6b,0x38,0x84,0x7d,0xae,0x17,0xa2,0xc4,0xda,0xfa,0x42,0xeb,0xa8,0xf5,0x65,0x52,0x47,0x79,0x63,0xe1,0xf2,0x11,0x7d,0xd1,0xae,0xa8,0xab,0x6c,0xf2,0x2d,0xbb,0x93,0xd3,0xdf,0x8a,0x93,0xeb,0x14,0x2e,0x79,0xae,0xc5,0x54,0x15,0xc9,0x9d,0xa0,0xd1,0x38,0xb6,0xc8,0x54,0x22,0x0,0xf0,0x43,0xf5,0xcd,0xa7,0xc0,0x6e,0x21,0xd2,0xa0,0x76,0x50,0x13,0x4b,0x26,0x52,0x7b,0xeb,0xee,0xd3,0x83,0x17,0x8a,0xf4,0x16,0xa3,0x5a,0x6d,0xbd,0x63,0x5c,0x3,0x40,0x16,0xeb,0x21,0x4f,0xd3,0x77,0xf7,0xa0,0x10,0x7c,0x2d,0xc,0xd5,0x7d,0xd9,0x8f,0xb0,0xf,0xa,0x83,0xde,0x8f,0xe6,0x7d,0x23,0xf,0xda,0xb0,0xc3,0x15,0xd0,0xc5,0x1a,0xbb,0xe9,0x4c,0x5b,0x95,0xd9,0x8e,0xf5,0x4a,0x10,0x97,0x90,0x6e,0x5b,0x54,0xbb,0xc1,0x8e,0x19,0x42,0x4a,0xf3,0xc8,0x31,0xc4,0xd6,0x36,0x5c,0xb5,0x2d,0x30,0x85,0xa7,0xb7,0x51,0xcb,0x79,0x3b,0x7d,0x1c,0x35,0x4,0xad,0xe,0x12,0xf4,0x4f,0x9e,0x23,0xba,0x64,0xf3,0x5c,0x78,0xd0,0x24,0x31,0xe5,0xfa,0xfe,0x43,0x1b,0x13,0x19,0x5b,0xdf,0x63,0x78,0xb5,0xbf,0x79,0x5,0x8,0x3a,0xaf,0x3b,0x18,0xe6,0x2a,0xff,0x6e,0xa1,0x4d,0x4b,0xb8,0x25,0xba,0xeb,0xf7,0xf7,0x4b,0x96,0x5a,0xaa,0x89,0xfe,0xae,0x9f,0x1d,0x37,0xdb,0xca,0xda,0x36,0xd2,0xce,0x69,0x54,0xda,0xee,0x51,0x7e,0xd3,0x9a,0x95,0x7c,0x5c,0xab,0x5b,0xa1,0x5b,0x2b,0xcd,0x80,0x42,0x3,0x99,0xb0,0x3b,0x79,0xb2,0xe5,0xe9,0xe8,0x3b,0xb1,0xc1,0x88,0xd9,0x3d,0x7a,0x1f,0xe,0xee,0x85,0x8c,0xca,0xfd,0xaa,0x81,0x36,0xaa,0x68,0xf7,0xda,0x6f,0x4c,0x93,0xf4,0xc,0x87,0xc2,0xa9,0x99,0xa6,0x1f,0xa4,0x98,0x17,0x6c,0xd8,0x66,0x41,0xe8,0x64,0x88,0x33,0x1b,0xe6,0x5e,0xc9,0x56,0xab,0x73,0x33,0x91,0x4b,0xb8,0xc4,0x14,0x46,0x3f,0xde,0xc8,0xfc,0xef,0x2a,0xa0,0x3f,0xc3,0x41,0x1e,0xce,0xe4,0x6,0x56,0x85,0xae,0xa3,0x7b,0xc4,0x60,0x4,0x72,0x97,0x34,0xfa,0x83,0xb2,0xf5,0x14,0xeb,0xfa,0x33,0x65,0x5f,0xea,0xb1,0xc6,0x8c,0xc9,0x74,0x24,0x74,0x29,0x40,0x34,0xf7,0x12,0x3f,0xa5,0xce,0x20,0x2d,0x92,0x6a,0x89,0x35,0xca,0xef,0x95,0x28,0x37,0xd7,0x10,0x23,0x9,0x2a,0x23,0xcf,0xa1,0x0,0x1,0x12,0x93,0xc1,0xda,0xa,0x31,0x62,0xd0,0xf6,0x5e,0x80,0x16,0xf0,0x45,0xc0,0x2e,0xb8,0x91,0x8,0xbb,0xe8,0x46,0x97,0x36,0x2f,0x23,0x51,0x9f,0x81,0xe5,0x70,0xa8,0x80,0xbf,0x1b,0x68,0x8c,0x65,0x6d,0x95,0x84,0xb8,0x47,0x88,0x7b,0x64,0xd2,0xc6,0x60,0xf4,0x7f,0xe0,0x70,0x3c,0x7b,0x24,0x24,0x0,0x0 };
 
 const uint8_t script_js[] PROGMEM = { 0x1f,0x8b,0x8,0x0,0x69,0x6b,0xf0,0x61,0x2,0xff,0x9d,0x56,0x5b,0x6f,0xdb,0x36,0x14,0x7e,0xf7,0xaf,0x60,0x55,0xa0,0x92,0x53,0x57,0x4a,0x96,0x5d,0xba,0x18,0x19,0xb0,0xa5,0x9,0x1a,0xa0,0xd9,0x80,0x25,0x43,0x1e,0xd2,0xc0,0x90,0xa9,0x23,0x89,0x8b,0x4c,0x7a,0x24,0x65,0x27,0x58,0xf3,0xdf,0x77,0x78,0xd1,0xd5,0x5e,0xbb,0x2e,0xf,0x81,0x75,0xf8,0x9d,0xef,0xdc,0xf,0x99,0x1c,0x4c,0x8,0x21,0x37,0x25,0x53,0x44,0x89,0x5c,0x6f,0x53,0x9,0x4,0x7f,0x57,0x8c,0x2,0x57,0x90,0x91,0x9a,0x67,0x20,0x89,0x2e,0x81,0x5c,0x5d,0xde,0x90,0xf,0x4e,0x1c,0x93,0x6b,0x0,0x2b,0xf4,0x38,0x92,0xb3,0xa,0xff,0x9,0x49,0x32,0xd0,0x29,0xab,0x54,0x6c,0x58,0xaf,0x45,0x2d,0x29,0x9c,0x90,0x52,0xeb,0xb5,0x3a,0x49,0x92,0x82,0xe9,0xb2,0x5e,0xc6,0x54,0xac,0x12,0xb5,0x4e,0x29,0x94,0x75,0xc9,0x35,0xd0,0x32,0xb9,0x65,0x17,0xec,0x5d,0x4d,0x1f,0x26,0xe4,0x20,0x99,0x4c,0x92,0x84,0x9c,0x9a,0x3f,0xf2,0x1e,0xaa,0x35,0x1a,0xbf,0xa8,0x39,0xd5,0x4c,0x70,0xe5,0xc5,0x49,0x32,0xc9,0xbd,0x88,0x54,0xa2,0x88,0x56,0xaa,0x98,0x92,0xbf,0xd1,0x20,0x45,0x8c,0xa8,0x20,0x6e,0x84,0xf3,0xc9,0xf3,0xa4,0x83,0x9e,0x47,0x2c,0x73,0x38,0x9,0xba,0x96,0x9c,0x64,0x82,0xd6,0x2b,0xe0,0x3a,0x2e,0x40,0x9f,0x57,0x60,0x7e,0xfe,0xf2,0x74,0x99,0x19,0xd8,0x50,0x33,0x13,0x5b,0x5e,0x89,0x34,0x5b,0xe8,0x47,0x1d,0x99,0x48,0x7f,0x4d,0x57,0x30,0xb3,0x31,0x9f,0x9,0x8c,0x80,0x6b,0xc7,0xbb,0x49,0x25,0x1,0x47,0x44,0x4e,0x3b,0x7a,0x2a,0x21,0xd5,0xe0,0x2d,0x44,0x61,0x1a,0x22,0x3d,0x69,0x80,0xb1,0x2,0xfd,0xb3,0xd6,0x92,0x2d,0x6b,0xd,0x51,0x58,0x4a,0xc8,0xc3,0x19,0x9,0xb3,0x54,0xa7,0x27,0x1a,0x1e,0x75,0xb2,0xae,0x52,0xc6,0xe7,0xb4,0x4c,0x25,0x22,0x4f,0x6b,0x9d,0xbf,0x79,0x3b,0xb,0xc9,0x6b,0x2,0x9c,0x8a,0xc,0xfe,0xf8,0xfd,0xf2,0x4c,0xac,0xd6,0x82,0x1b,0xea,0xbe,0x43,0x9f,0xb1,0xd1,0x84,0x13,0xba,0x10,0x4c,0x30,0x88,0xee,0xc3,0xf5,0x13,0x66,0x31,0x63,0xa,0x6d,0x3f,0x61,0x24,0x21,0x47,0xfe,0xd0,0x10,0xb6,0x31,0x2d,0x45,0xf6,0x14,0xa7,0xeb,0x35,0xf0,0xec,0xac,0x64,0x55,0x16,0x79,0xdd,0x21,0x11,0xc5,0xf6,0x78,0x88,0x9c,0x6c,0xa8,0x2a,0x61,0x25,0x36,0x30,0x56,0xed,0x27,0x3d,0x67,0x8f,0x17,0xde,0xbb,0x36,0xe7,0x2e,0xcd,0x2c,0x27,0xad,0x24,0xae,0x80,0x17,0xba,0x24,0x3f,0x91,0x43,0x77,0x38,0x3c,0xbe,0x3b,0xbc,0x27,0x2f,0x30,0x80,0x24,0x6c,0x4e,0x49,0x1b,0x33,0xb1,0x72,0xcc,0x64,0x23,0x98,0x5b,0xc0,0xf3,0x64,0x32,0x42,0xb5,0xb6,0x24,0x60,0x42,0x28,0x44,0x9,0x49,0xa,0xac,0xd1,0xc7,0x37,0xae,0x92,0xcf,0x5d,0x4b,0x75,0x54,0xcf,0xbd,0x3e,0x7e,0xf7,0xdb,0x15,0xb9,0x4a,0x39,0x5b,0xd7,0x55,0x6a,0x63,0xdb,0xed,0x63,0xa5,0x53,0x5d,0xab,0x68,0x85,0x25,0xf5,0xbd,0x5c,0x4b,0x89,0x49,0x59,0xb8,0x3,0xf4,0xc2,0x1c,0xd9,0x44,0x9a,0xf8,0xcc,0x7,0xb2,0x90,0x0,0x5b,0x9e,0x3,0xd5,0x90,0x5,0x4d,0x80,0xe7,0x51,0xe0,0x74,0x82,0xa9,0x2f,0xe4,0x32,0xa5,0xf,0x85,0x14,0x38,0xc9,0x67,0xa2,0xc2,0x11,0x45,0xb5,0x97,0xc7,0xf4,0xbb,0xc0,0xfa,0x8e,0xb5,0xc2,0xf1,0x1d,0x70,0x62,0xe1,0xff,0x2f,0x6d,0x76,0x7c,0xbc,0x8f,0x36,0x66,0x9c,0x56,0x75,0x6,0x2a,0xa,0xd6,0x52,0x2c,0xb1,0xde,0xc8,0xfb,0xe9,0x13,0x19,0x9d,0x81,0x94,0x42,0x6,0xd3,0xaf,0x33,0x99,0xe7,0xf4,0xe8,0xf0,0x87,0xbe,0xd5,0xe4,0x60,0x5f,0x8a,0x18,0x2f,0xe2,0x38,0xe,0xa6,0x7,0xc9,0x57,0xd1,0x1f,0xa6,0xe0,0xb8,0x4d,0xea,0xfb,0x2a,0xc,0x59,0xe5,0xfb,0x9b,0xab,0xf,0x6d,0x6d,0xfa,0x25,0xbf,0x85,0x25,0xae,0x3f,0xfa,0x0,0x7a,0xff,0xd2,0x5a,0x6c,0x55,0xb7,0xb7,0xcc,0xbe,0xa,0xee,0x6e,0xaf,0xef,0x49,0x80,0xed,0xb8,0xbb,0xb9,0x70,0x7c,0x17,0x1b,0x90,0xa,0x7f,0x47,0x4a,0x4b,0xa7,0x84,0xbe,0x78,0xd9,0xc8,0x19,0x44,0x58,0x75,0xb3,0x8d,0xb6,0xa6,0x73,0x78,0x5d,0x55,0x73,0x74,0x80,0x6c,0xd1,0x29,0xe5,0x9c,0x62,0x1c,0x3,0xe1,0x14,0x3c,0x6a,0x41,0xd3,0xaa,0x32,0xe1,0x23,0xdc,0x79,0x67,0x15,0x56,0xa0,0x54,0x5a,0x0,0x76,0x37,0x5,0xb6,0x1,0xd2,0xa0,0x1a,0x2d,0x74,0x75,0xf1,0x57,0xd,0xb5,0x99,0x92,0xbb,0x7b,0xab,0xe2,0x3e,0xcd,0x4d,0x20,0x6a,0x5d,0x8,0xcc,0x7a,0xc3,0xa2,0xac,0x16,0xd5,0xc6,0xa5,0x3c,0xc5,0x42,0x59,0x3c,0xad,0x0,0xa5,0x5a,0x60,0x90,0x3c,0x23,0x79,0x95,0x16,0x56,0xb9,0xb1,0x6c,0xe9,0x5c,0x2c,0x3b,0x13,0x11,0x60,0x61,0x1a,0x4f,0x2c,0x6e,0xc1,0x70,0xf7,0xc9,0x4d,0x5a,0x35,0x41,0xf,0xb,0xe2,0xeb,0xf1,0xb9,0xeb,0xa4,0x1f,0xd3,0xa2,0x5e,0xe3,0x16,0x86,0xa8,0x5b,0x3a,0xc6,0xf7,0x57,0xaf,0x6,0xa0,0xd1,0xfe,0xb1,0x8d,0x65,0x5c,0x62,0x1a,0x56,0xe8,0xc5,0x0,0xaa,0x4a,0x96,0x6b,0xbf,0xd,0x1d,0xaa,0x89,0xf2,0xd4,0xe2,0x63,0xff,0x39,0x6f,0xcf,0x7b,0x55,0xb1,0x80,0xe6,0xdb,0x53,0x6c,0x55,0x6c,0xb2,0x16,0x79,0xbd,0xe9,0xdc,0x4b,0xfb,0xd5,0x1c,0xa9,0x34,0x57,0x64,0x6,0xcb,0x1a,0x9b,0xee,0xa5,0xeb,0xb8,0x81,0x7e,0xbf,0x42,0xb6,0xf1,0xfb,0xad,0x88,0xe4,0x7d,0x93,0xb3,0x96,0x7f,0x66,0xca,0x46,0xa1,0xd1,0xec,0x92,0xf6,0xc2,0x43,0x63,0x54,0x53,0xb7,0xf8,0x2,0x88,0xc2,0x8f,0x3c,0xc4,0x21,0x6f,0x82,0x7f,0x8d,0x7b,0x18,0x25,0xd6,0x41,0x4f,0xbf,0x90,0xe9,0xf6,0x5f,0x4d,0x8c,0x86,0xe3,0xbf,0xa8,0xc,0xbd,0x32,0x99,0x15,0xcb,0x3f,0x51,0xe8,0x16,0x41,0xe0,0xd5,0x82,0x93,0xc6,0xa7,0x99,0x93,0x37,0x2c,0x78,0xd0,0x76,0x3e,0x26,0xa4,0xdd,0xc2,0xce,0x1d,0xcf,0x32,0x28,0x75,0xcd,0x5d,0xb1,0xd1,0xcc,0xb4,0xb7,0x99,0xf6,0x20,0xd7,0xb5,0x2a,0x3b,0xd8,0x38,0x32,0xd7,0x82,0xbe,0xe5,0x7d,0x27,0x36,0x25,0x68,0x56,0xd1,0xcc,0x5f,0x1e,0xbb,0x79,0x61,0x9c,0x69,0xaf,0xe4,0x19,0xc6,0xcb,0xd0,0x27,0xdd,0xcc,0xb,0x6c,0xbb,0x19,0x89,0x82,0xad,0x79,0xaf,0x1d,0xfd,0xf8,0x4d,0x7c,0xf4,0xfd,0xdb,0xf8,0xdb,0xf8,0x28,0xd9,0xaa,0x16,0x1d,0xb,0x2e,0xf0,0xe2,0x37,0x49,0xf5,0xc6,0x22,0xd8,0xb4,0x8f,0x20,0xd2,0xac,0xb7,0xfe,0xdd,0xe4,0x3a,0x6b,0xe4,0x84,0x3b,0x68,0x52,0xe2,0x62,0xa2,0x95,0x50,0x80,0x21,0x39,0x8e,0x19,0xd1,0xb2,0xee,0xf5,0xb5,0xc3,0x34,0x6b,0x6f,0xd6,0x5f,0x8c,0x3d,0xa6,0x96,0x3e,0x72,0x49,0xed,0xdc,0xb6,0xec,0x5f,0xf4,0x7b,0x78,0xff,0xd,0x5d,0xdf,0x3d,0xeb,0xd1,0x77,0xe3,0xbc,0xdf,0x80,0x1d,0x79,0x55,0xe0,0xb9,0x15,0xc7,0xe6,0x91,0xe7,0xdd,0xee,0x5d,0x9,0x5e,0x62,0x1a,0xac,0x3f,0xca,0xb8,0x78,0xf0,0x74,0xcf,0x7b,0x67,0x30,0xf1,0x9e,0xa1,0xf7,0x90,0x71,0xe3,0x6c,0xf2,0x38,0xf2,0xd6,0xde,0xb6,0x5f,0x4c,0x86,0xbf,0x93,0x87,0x59,0x68,0x85,0x83,0x9d,0x62,0xa5,0x9e,0xa5,0xb3,0xd5,0xb7,0x3f,0x69,0xc3,0x1a,0xee,0xeb,0xa9,0xbb,0x6,0x2e,0xfd,0xe7,0x1e,0xc0,0xdc,0x35,0xfe,0xce,0x9a,0xc7,0xe,0xe8,0x6b,0x8d,0x97,0xf7,0x8c,0x1c,0x99,0xb1,0xf8,0x7,0xd,0xab,0x65,0x55,0xe5,0xc,0x0,0x0 };
 
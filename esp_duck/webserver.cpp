@@ -110,6 +110,27 @@ namespace webserver {
             }, false);
         });
 
+        // Files are read straight into the response, in chunks as large as the connection takes
+        server.on("/file", HTTP_GET, [](AsyncWebServerRequest* request) {
+            if (!request->hasParam("name")) {
+                request->send(400, "text/plain", "No file name");
+                return;
+            }
+
+            String fileName = request->getParam("name")->value();
+
+            if (!spiffs::exists(fileName)) {
+                request->send(404, "text/plain", "File not found");
+                return;
+            }
+
+            File f = spiffs::open(fileName);
+
+            request->send(request->beginChunkedResponse("text/plain", [f](uint8_t* buffer, size_t maxLen, size_t index) mutable -> size_t {
+                return f.read(buffer, maxLen);
+            }));
+        });
+
         WEBSERVER_CALLBACK;
 
         // Arduino OTA Update
@@ -18,6 +18,9 @@ var unsaved_changed = false;
 // ! Flag if editor has loaded a file yet
 var file_opened = false;
 
+// ! Free bytes of the RAM disk (/ram/) returned by "mem" command
+var ram_free = 0;
+
 // ========== Global Functions ========== //
 
 // ===== Value Getters ===== //
@@ -87,6 +90,8 @@ function update_file_list() {
     var used = lines[1].split(" ")[0];
     var free = lines[2].split(" ")[0];
 
+    ram_free = parse_ram_free(lines);
+
     var percent = Math.floor(byte / 100);
     var freepercent = Math.floor(free / percent);
 
@@ -157,21 +162,7 @@ function stopAll() {
   ws_send("stop", log_ws, true);
 }
 
-// ! Recursive read from stream
-function read_stream() {
-  ws_send("read", function(content) {
-    if (content != "> END") {
-      E("editor").value += content;
-      read_stream();
-      status("reading...");
-    } else {
-      ws_send("close", log_ws);
-      ws_update_status();
-    }
-  });
-}
-
-// ! Open stream to a file
+// ! Download a file into the editor, in one request instead of one "read" per KB
 function read(fileName) {
   stop(fileName);
 
@@ -180,9 +171,21 @@ function read(fileName) {
   set_editor_filename(fileName);
   E("editor").value = "";
 
-  ws_send("stream \"" + fileName + "\"", log_ws);
+  status("reading...");
+
+  var request = new XMLHttpRequest();
 
-  read_stream(); // !< Read file contents (recursively)
+  request.onload = function() {
+    if (request.status == 200) {
+      E("editor").value = request.responseText;
+    } else {
+      log("[HTTP] " + request.responseText);
+    }
+    ws_update_status();
+  };
+
+  request.open("GET", "/file?name=" + encodeURIComponent(fileName));
+  request.send();
 
   file_opened = true;
 }
@@ -216,20 +219,42 @@ function autorun(fileName) {
   ws_send("set autorun \"" + fixFileName(fileName) + "\"", log_ws);
 }
 
+// ! Returns the free bytes of the RAM disk from the response of "mem"
+function parse_ram_free(lines) {
+  return lines.length > 3 ? parseInt(lines[3].split(" ")[0]) : 0;
+}
+
 // ! Write content to file
 function write(fileName, content) {
   stop(fileName);
 
   fileName = fixFileName(fileName);
 
-  ws_send("remove \"/temporary_script\"", log_ws);
-  ws_send("create \"/temporary_script\"", log_ws);
+  // Staged in RAM when it fits, so only the final file is written to flash.
+  // Other files may have been written since the last "mem", so ask again.
+  var bytes = unescape(encodeURIComponent(content)).length;
+
+  ws_send("mem", function(msg) {
+    ram_free = parse_ram_free(msg.split(/\n/));
+
+    stage(fileName, content, bytes < ram_free ? "/ram/temporary_script" : "/temporary_script");
+  });
+}
 
-  ws_send("stream \"/temporary_script\"", log_ws);
+// ! Writes content to tmpFile and only replaces fileName if all of it was written
+function stage(fileName, content, tmpFile) {
+  var failed = false;
+
+  ws_send("remove \"" + tmpFile + "\"", log_ws);
+  ws_send("create \"" + tmpFile + "\"", log_ws);
+
+  ws_send("stream \"" + tmpFile + "\"", log_ws);
 
   var ws_send_log = function(msg) {
     status("saving...");
     log_ws(msg);
+
+    if (msg.indexOf("ERROR") >= 0) failed = true;
   };
 
   var pktsize = 1024;
@@ -242,12 +267,29 @@ function write(fileName, content) {
     ws_send_raw(content.substring(begin, end), ws_send_log);
   }
 
-  ws_send("close", log_ws);
+  ws_send("close", function(msg) {
+    log_ws(msg);
+
+    if (!failed) {
+      ws_send("remove \"" + fileName + "\"", log_ws);
+      ws_send("rename \"" + tmpFile + "\" \"" + fileName + "\"", log_ws);
+    } else {
+      ws_send("remove \"" + tmpFile + "\"", log_ws);
+
+      // The RAM disk filled up, try again on flash
+      if (tmpFile != "/temporary_script") {
+        stage(fileName, content, "/temporary_script");
+        return;
+      }
 
-  ws_send("remove \"" + fileName + "\"", log_ws);
-  ws_send("rename \"/temporary_script\" \"" + fileName + "\"", log_ws);
+      status("error");
+      E("editorinfo").innerHTML = "couldn't save " + fileName;
+      unsaved_changed = true;
+    }
 
-  ws_update_status();
+    ws_update_status();
+    update_file_list();
+  });
 }
 
 // ! Save file that is currently open in the editor